@@ -27,6 +27,7 @@ public:
 	static void ThreadIdle();
 	static void FlushAll();
 	static void SetBackgroundThreads(bool enable);
+	static void SetThreadNUMANode(idx_t numa_node);
 };
 
 } // namespace duckdb
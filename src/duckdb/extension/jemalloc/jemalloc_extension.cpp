@@ -109,6 +109,28 @@ void JemallocExtension::SetBackgroundThreads(bool enable) {
 #endif
 }
 
+void JemallocExtension::SetThreadNUMANode(idx_t numa_node) {
+	// by default, jemalloc assigns threads to its arenas round-robin, so an arena serves threads of every node
+	// we create one extra arena per node, which are shared by all databases in the process
+	static mutex lock;
+	static vector<unsigned> node_arenas;
+	unsigned arena;
+	{
+		lock_guard<mutex> guard(lock);
+		while (node_arenas.size() <= numa_node) {
+			unsigned new_arena;
+			size_t len = sizeof(new_arena);
+			if (duckdb_je_mallctl("arenas.create", &new_arena, &len, nullptr, 0) != 0) {
+				// could not create the arena - keep using the default arena of this thread
+				return;
+			}
+			node_arenas.push_back(new_arena);
+		}
+		arena = node_arenas[numa_node];
+	}
+	SetJemallocCTL("thread.arena", arena);
+}
+
 std::string JemallocExtension::Version() const {
 #ifdef EXT_VERSION_JEMALLOC
 	return EXT_VERSION_JEMALLOC;
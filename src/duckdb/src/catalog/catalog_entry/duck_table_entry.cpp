@@ -22,6 +22,7 @@
 #include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
 #include "duckdb/parser/expression/function_expression.hpp"
 #include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/table/column_data.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
 
 namespace duckdb {
@@ -236,6 +237,10 @@ unique_ptr<CatalogEntry> DuckTableEntry::AlterEntry(ClientContext &context, Alte
 		auto &add_constraint_info = table_info.Cast<AddConstraintInfo>();
 		return AddConstraint(context, add_constraint_info);
 	}
+	case AlterTableType::SET_BLOOM_FILTER: {
+		auto &set_bloom_filter_info = table_info.Cast<SetBloomFilterInfo>();
+		return SetBloomFilter(context, set_bloom_filter_info);
+	}
 	case AlterTableType::SET_PARTITIONED_BY:
 		throw NotImplementedException("SET PARTITIONED BY is not supported for DuckDB tables");
 	case AlterTableType::SET_SORTED_BY:
@@ -1070,6 +1075,42 @@ unique_ptr<CatalogEntry> DuckTableEntry::ChangeColumnType(ClientContext &context
 	return std::move(result);
 }
 
+unique_ptr<CatalogEntry> DuckTableEntry::SetBloomFilter(ClientContext &context, SetBloomFilterInfo &info) {
+	auto create_info = make_uniq<CreateTableInfo>(schema, name);
+	create_info->comment = comment;
+	create_info->tags = tags;
+
+	auto bloom_filter_idx = GetColumnIndex(info.column_name);
+	auto &column = columns.GetColumn(bloom_filter_idx);
+	if (column.Generated()) {
+		throw BinderException("Cannot create a Bloom filter for generated column \"%s\"", column.Name());
+	}
+	if (info.bloom_filter && !ColumnData::SupportsBloomFilter(column.Type())) {
+		throw NotImplementedException("Bloom filters are not supported for column \"%s\" of type %s", column.Name(),
+		                              column.Type().ToString());
+	}
+
+	// Copy all the columns, changing the declaration of the one that was specified by 'column_name'
+	for (auto &col : columns.Logical()) {
+		auto copy = col.Copy();
+		if (bloom_filter_idx == col.Logical()) {
+			copy.SetBloomFilter(info.bloom_filter);
+		}
+		create_info->columns.AddColumn(std::move(copy));
+	}
+	// Copy all the constraints
+	for (idx_t i = 0; i < constraints.size(); i++) {
+		create_info->constraints.push_back(constraints[i]->Copy());
+	}
+	auto binder = Binder::CreateBinder(context);
+	auto bound_create_info = binder->BindCreateTableInfo(std::move(create_info), schema);
+	if (column.HasBloomFilter() == info.bloom_filter) {
+		return make_uniq<DuckTableEntry>(catalog, schema, *bound_create_info, storage);
+	}
+	auto new_storage = make_shared_ptr<DataTable>(context, *storage, column.Physical().index, info.bloom_filter);
+	return make_uniq<DuckTableEntry>(catalog, schema, *bound_create_info, new_storage);
+}
+
 unique_ptr<CatalogEntry> DuckTableEntry::SetColumnComment(ClientContext &context, SetColumnCommentInfo &info) {
 	auto create_info = make_uniq<CreateTableInfo>(schema, name);
 	create_info->comment = comment;
@@ -642,7 +642,8 @@ void DependencyManager::AlterObject(CatalogTransaction transaction, CatalogEntry
 				disallow_alter = false;
 				break;
 			}
-			case AlterTableType::ADD_COLUMN: {
+			case AlterTableType::ADD_COLUMN:
+			case AlterTableType::SET_BLOOM_FILTER: {
 				disallow_alter = false;
 				break;
 			}
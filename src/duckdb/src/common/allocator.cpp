@@ -287,6 +287,12 @@ void Allocator::SetBackgroundThreads(bool enable) {
 #endif
 }
 
+void Allocator::SetThreadNUMANode(idx_t numa_node) {
+#ifdef USE_JEMALLOC
+	JemallocExtension::SetThreadNUMANode(numa_node);
+#endif
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Info (extended)
 //===--------------------------------------------------------------------===//
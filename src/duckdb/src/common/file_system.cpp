@@ -418,6 +418,16 @@ int64_t FileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	throw NotImplementedException("%s: Write is not implemented!", GetName());
 }
 
+void FileSystem::ReadBatch(FileHandle &handle, vector<FileIORequest> &requests) {
+	for (auto &request : requests) {
+		Read(handle, request.buffer, NumericCast<int64_t>(request.nr_bytes), request.location);
+	}
+}
+
+bool FileSystem::SupportsConcurrentBatchRead(FileHandle &handle) {
+	return false;
+}
+
 bool FileSystem::Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes) {
 	// This is not a required method. Derived FileSystems may optionally override/implement.
 	return false;
@@ -703,6 +713,10 @@ void FileHandle::Read(void *buffer, idx_t nr_bytes, idx_t location) {
 	file_system.Read(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes), location);
 }
 
+void FileHandle::ReadBatch(vector<FileIORequest> &requests) {
+	file_system.ReadBatch(*this, requests);
+}
+
 void FileHandle::Write(QueryContext context, void *buffer, idx_t nr_bytes, idx_t location) {
 	// FIXME: Add profiling.
 	file_system.Write(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes), location);
@@ -0,0 +1,288 @@
+#include "duckdb/common/io_uring.hpp"
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/file_system.hpp"
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>) && __has_include(<sys/syscall.h>)
+#define DUCKDB_IO_URING_SUPPORTED
+#endif
+#endif
+
+#ifdef DUCKDB_IO_URING_SUPPORTED
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace duckdb {
+
+#ifdef DUCKDB_IO_URING_SUPPORTED
+
+//! Set to true once setting up a ring failed, after which we no longer try to use io_uring
+static atomic<bool> io_uring_unavailable {false};
+#endif
+
+//! The failure that is injected into io_uring reads, for testing
+static atomic<IOUringFailure> io_uring_failure {IOUringFailure::NONE};
+
+#ifdef DUCKDB_IO_URING_SUPPORTED
+
+//! A submission and completion queue pair, used by a single thread
+class IOUringRing {
+public:
+	static constexpr unsigned QUEUE_DEPTH = 64;
+
+	IOUringRing() {
+		io_uring_params params;
+		memset(&params, 0, sizeof(params));
+		auto fd = syscall(__NR_io_uring_setup, QUEUE_DEPTH, &params);
+		if (fd < 0) {
+			return;
+		}
+		ring_fd = static_cast<int>(fd);
+		sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+		cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+		if (single_mmap) {
+			sq_ring_size = MaxValue<size_t>(sq_ring_size, cq_ring_size);
+			cq_ring_size = sq_ring_size;
+		}
+		sq_ptr = mmap(nullptr, sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd,
+		              IORING_OFF_SQ_RING);
+		if (sq_ptr == MAP_FAILED) {
+			sq_ptr = nullptr;
+			return;
+		}
+		if (single_mmap) {
+			cq_ptr = sq_ptr;
+		} else {
+			cq_ptr = mmap(nullptr, cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd,
+			              IORING_OFF_CQ_RING);
+			if (cq_ptr == MAP_FAILED) {
+				cq_ptr = nullptr;
+				return;
+			}
+		}
+		sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+		auto sqes_ptr = mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd,
+		                     IORING_OFF_SQES);
+		if (sqes_ptr == MAP_FAILED) {
+			return;
+		}
+		sqes = static_cast<io_uring_sqe *>(sqes_ptr);
+
+		auto sq_base = static_cast<uint8_t *>(sq_ptr);
+		sq_head = reinterpret_cast<unsigned *>(sq_base + params.sq_off.head);
+		sq_tail = reinterpret_cast<unsigned *>(sq_base + params.sq_off.tail);
+		sq_mask = *reinterpret_cast<unsigned *>(sq_base + params.sq_off.ring_mask);
+		sq_array = reinterpret_cast<unsigned *>(sq_base + params.sq_off.array);
+		sq_entries = params.sq_entries;
+
+		auto cq_base = static_cast<uint8_t *>(cq_ptr);
+		cq_head = reinterpret_cast<unsigned *>(cq_base + params.cq_off.head);
+		cq_tail = reinterpret_cast<unsigned *>(cq_base + params.cq_off.tail);
+		cq_mask = *reinterpret_cast<unsigned *>(cq_base + params.cq_off.ring_mask);
+		cqes = reinterpret_cast<io_uring_cqe *>(cq_base + params.cq_off.cqes);
+	}
+
+	~IOUringRing() {
+		if (sqes) {
+			munmap(sqes, sqes_size);
+		}
+		if (cq_ptr && !single_mmap) {
+			munmap(cq_ptr, cq_ring_size);
+		}
+		if (sq_ptr) {
+			munmap(sq_ptr, sq_ring_size);
+		}
+		if (ring_fd >= 0) {
+			close(ring_fd);
+		}
+	}
+
+	bool IsValid() const {
+		return sqes != nullptr;
+	}
+
+	bool ReadBatch(int fd, vector<FileIORequest> &requests, vector<int64_t> &results, IOUringFailure failure) {
+		auto count = requests.size();
+		// the io vectors must stay alive until the reads have completed
+		vector<iovec> io_vectors(count);
+		results.resize(count);
+
+		idx_t queued = 0;
+		idx_t completed = 0;
+		while (completed < count) {
+			// queue as many reads as fit in the submission queue
+			auto tail = *sq_tail;
+			auto head = __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+			while (queued < count && queued - completed < sq_entries && tail - head < sq_entries) {
+				auto &request = requests[queued];
+				io_vectors[queued].iov_base = request.buffer;
+				io_vectors[queued].iov_len = request.nr_bytes;
+
+				auto index = tail & sq_mask;
+				auto &sqe = sqes[index];
+				memset(&sqe, 0, sizeof(sqe));
+				sqe.opcode = IORING_OP_READV;
+				sqe.fd = fd;
+				sqe.addr = reinterpret_cast<uint64_t>(&io_vectors[queued]);
+				sqe.len = 1;
+				sqe.off = request.location;
+				sqe.user_data = queued;
+				sq_array[index] = index;
+				tail++;
+				queued++;
+			}
+			__atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+
+			// submit the queued reads and wait for at least one of them to complete
+			auto to_submit = tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+			long ret;
+			if (failure == IOUringFailure::SUBMIT) {
+				ret = -1;
+				errno = EPERM;
+			} else if (failure == IOUringFailure::WAIT) {
+				ret = syscall(__NR_io_uring_enter, ring_fd, to_submit, 0, 0, nullptr, 0);
+				if (ret >= 0) {
+					ret = -1;
+					errno = EIO;
+				}
+			} else {
+				ret = syscall(__NR_io_uring_enter, ring_fd, to_submit, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+			}
+			if (ret < 0) {
+				auto error = errno;
+				if (error == EINTR || error == EAGAIN || error == EBUSY) {
+					continue;
+				}
+				// take the reads that the kernel did not accept back out of the queue
+				auto head = __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+				__atomic_store_n(sq_tail, head, __ATOMIC_RELEASE);
+				auto submitted = queued - (tail - head);
+				if (submitted == 0) {
+					// the kernel did not accept any of the reads (e.g. io_uring_enter is blocked)
+					// the caller can fall back to regular reads
+					return false;
+				}
+				// the submitted reads still write into the buffers and io vectors of this batch, and their
+				// completions would be attributed to the next batch - wait for all of them before throwing
+				WaitForCompletions(submitted, completed, results);
+				throw IOException("Could not wait for io_uring reads to complete: %s", strerror(error));
+			}
+			ReapCompletions(completed, results);
+		}
+		return true;
+	}
+
+private:
+	//! Collects the results of the completed reads
+	void ReapCompletions(idx_t &completed, vector<int64_t> &results) {
+		auto cq_current = *cq_head;
+		auto cq_end = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+		while (cq_current != cq_end) {
+			auto &cqe = cqes[cq_current & cq_mask];
+			results[cqe.user_data] = cqe.res;
+			cq_current++;
+			completed++;
+		}
+		__atomic_store_n(cq_head, cq_current, __ATOMIC_RELEASE);
+	}
+
+	//! Waits until the first "submitted" reads of the batch have completed
+	void WaitForCompletions(idx_t submitted, idx_t &completed, vector<int64_t> &results) {
+		ReapCompletions(completed, results);
+		while (completed < submitted) {
+			auto ret = syscall(__NR_io_uring_enter, ring_fd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+			if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+				// we cannot tell when the reads that are in flight finish - they could write into freed memory
+				throw FatalException("Could not wait for in-flight io_uring reads: %s", strerror(errno));
+			}
+			ReapCompletions(completed, results);
+		}
+	}
+
+	int ring_fd = -1;
+	bool single_mmap = false;
+	void *sq_ptr = nullptr;
+	void *cq_ptr = nullptr;
+	size_t sq_ring_size = 0;
+	size_t cq_ring_size = 0;
+	size_t sqes_size = 0;
+
+	unsigned *sq_head = nullptr;
+	unsigned *sq_tail = nullptr;
+	unsigned sq_mask = 0;
+	unsigned *sq_array = nullptr;
+	unsigned sq_entries = 0;
+	io_uring_sqe *sqes = nullptr;
+
+	unsigned *cq_head = nullptr;
+	unsigned *cq_tail = nullptr;
+	unsigned cq_mask = 0;
+	io_uring_cqe *cqes = nullptr;
+};
+
+static IOUringRing *GetThreadRing() {
+	if (io_uring_unavailable) {
+		return nullptr;
+	}
+	static thread_local unique_ptr<IOUringRing> ring;
+	if (!ring) {
+		ring = make_uniq<IOUringRing>();
+	}
+	if (!ring->IsValid()) {
+		// io_uring is not supported by the kernel or blocked - stop trying
+		io_uring_unavailable = true;
+		ring.reset();
+		return nullptr;
+	}
+	return ring.get();
+}
+
+bool IOUring::IsAvailable() {
+	return GetThreadRing() != nullptr;
+}
+
+bool IOUring::ReadBatch(int fd, vector<FileIORequest> &requests, vector<int64_t> &results) {
+	auto ring = GetThreadRing();
+	if (!ring) {
+		return false;
+	}
+	auto failure = io_uring_failure.load();
+	if (!ring->ReadBatch(fd, requests, results, failure)) {
+		if (failure != IOUringFailure::SUBMIT) {
+			io_uring_unavailable = true;
+		}
+		return false;
+	}
+	return true;
+}
+
+#else
+
+bool IOUring::IsAvailable() {
+	return false;
+}
+
+bool IOUring::ReadBatch(int fd, vector<FileIORequest> &requests, vector<int64_t> &results) {
+	return false;
+}
+
+#endif
+
+void IOUring::SetFailureInjection(IOUringFailure failure) {
+	io_uring_failure = failure;
+}
+
+IOUringFailure IOUring::GetFailureInjection() {
+	return io_uring_failure;
+}
+
+} // namespace duckdb
@@ -4,6 +4,7 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/io_uring.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/windows.hpp"
 #include "duckdb/function/scalar/string_common.hpp"
@@ -492,6 +493,33 @@ void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, i
 	DUCKDB_LOG_FILE_SYSTEM_READ(handle, bytes_to_read, location - UnsafeNumericCast<idx_t>(bytes_to_read));
 }
 
+void LocalFileSystem::ReadBatch(FileHandle &handle, vector<FileIORequest> &requests) {
+	int fd = handle.Cast<UnixFileHandle>().fd;
+	vector<int64_t> results;
+	if (requests.size() <= 1 || !IOUring::ReadBatch(fd, requests, results)) {
+		FileSystem::ReadBatch(handle, requests);
+		return;
+	}
+	for (idx_t i = 0; i < requests.size(); i++) {
+		auto &request = requests[i];
+		auto bytes_read = results[i];
+		if (bytes_read < 0) {
+			throw IOException("Could not read from file \"%s\": %s", {{"errno", std::to_string(-bytes_read)}},
+			                  handle.path, strerror(static_cast<int>(-bytes_read)));
+		}
+		if (UnsafeNumericCast<idx_t>(bytes_read) < request.nr_bytes) {
+			// short read - read the remainder (or fail if we are at the end of the file)
+			Read(handle, request.buffer + bytes_read, NumericCast<int64_t>(request.nr_bytes) - bytes_read,
+			     request.location + UnsafeNumericCast<idx_t>(bytes_read));
+		}
+		DUCKDB_LOG_FILE_SYSTEM_READ(handle, bytes_read, request.location);
+	}
+}
+
+bool LocalFileSystem::SupportsConcurrentBatchRead(FileHandle &handle) {
+	return IOUring::IsAvailable();
+}
+
 int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	auto &unix_handle = handle.Cast<UnixFileHandle>();
 	int fd = unix_handle.fd;
@@ -1012,6 +1040,14 @@ void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, i
 	DUCKDB_LOG_FILE_SYSTEM_READ(handle, bytes_read, location);
 }
 
+void LocalFileSystem::ReadBatch(FileHandle &handle, vector<FileIORequest> &requests) {
+	FileSystem::ReadBatch(handle, requests);
+}
+
+bool LocalFileSystem::SupportsConcurrentBatchRead(FileHandle &handle) {
+	return false;
+}
+
 int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	HANDLE hFile = handle.Cast<WindowsFileHandle>().fd;
 	auto &pos = handle.Cast<WindowsFileHandle>().position;
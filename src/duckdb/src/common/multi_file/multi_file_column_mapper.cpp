@@ -866,6 +866,10 @@ bool MultiFileColumnMapper::EvaluateFilterAgainstConstant(TableFilter &filter, c
 		auto &expr_filter = filter.Cast<ExpressionFilter>();
 		return expr_filter.EvaluateWithConstant(context, constant);
 	}
+	case TableFilterType::BLOOM_FILTER: {
+		auto &bloom_filter = filter.Cast<BloomFilter>();
+		return bloom_filter.FilterValue(constant);
+	}
 	default:
 		throw NotImplementedException("Can't evaluate TableFilterType (%s) against a constant",
 		                              EnumUtil::ToString(type));
@@ -1022,7 +1026,8 @@ static unique_ptr<TableFilter> TryCastTableFilter(const TableFilter &global_filt
 		return make_uniq<InFilter>(std::move(in_list));
 	}
 	case TableFilterType::EXPRESSION_FILTER:
-		// unsupported
+	case TableFilterType::BLOOM_FILTER:
+		// unsupported - the hashes of the values change with the type
 		return nullptr;
 	default:
 		throw NotImplementedException("Can't convert TableFilterType (%s) from global to local indexes",
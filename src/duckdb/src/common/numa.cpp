@@ -0,0 +1,90 @@
+#include "duckdb/common/numa.hpp"
+
+#include "duckdb/common/operator/cast_operators.hpp"
+#include "duckdb/common/string_util.hpp"
+
+namespace duckdb {
+
+vector<idx_t> NUMA::ParseCPUList(const string &cpu_list) {
+	vector<idx_t> result;
+	auto ranges = StringUtil::Split(cpu_list, ",");
+	for (auto &range : ranges) {
+		StringUtil::Trim(range);
+		if (range.empty()) {
+			continue;
+		}
+		auto bounds = StringUtil::Split(range, "-");
+		idx_t start;
+		idx_t end;
+		if (bounds.empty() || bounds.size() > 2 || !TryCast::Operation<string_t, idx_t>(string_t(bounds[0]), start)) {
+			return vector<idx_t>();
+		}
+		end = start;
+		if (bounds.size() == 2 && !TryCast::Operation<string_t, idx_t>(string_t(bounds[1]), end)) {
+			return vector<idx_t>();
+		}
+		for (idx_t cpu = start; cpu <= end; cpu++) {
+			result.push_back(cpu);
+		}
+	}
+	return result;
+}
+
+#if defined(__linux__) && !defined(DUCKDB_WASM)
+
+static constexpr const char *NUMA_NODE_PATH = "/sys/devices/system/node";
+static constexpr const int64_t DEFAULT_CPU_LIST_BUFFER_SIZE = 1024;
+
+static string ReadCPUList(FileSystem &fs, const string &path) {
+	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+
+	char buffer[DEFAULT_CPU_LIST_BUFFER_SIZE];
+	int64_t bytes_read;
+	string result;
+	do {
+		bytes_read = fs.Read(*handle, buffer, DEFAULT_CPU_LIST_BUFFER_SIZE - 1);
+		buffer[bytes_read] = '\0';
+		result += string(buffer);
+	} while (bytes_read >= DEFAULT_CPU_LIST_BUFFER_SIZE - 1);
+	return result;
+}
+
+vector<vector<idx_t>> NUMA::GetNodeCPUs(FileSystem &fs) {
+	vector<vector<idx_t>> result;
+	if (!fs.DirectoryExists(NUMA_NODE_PATH)) {
+		return result;
+	}
+	// the node directories are named "node<id>", node ids are not necessarily contiguous
+	vector<idx_t> node_ids;
+	fs.ListFiles(NUMA_NODE_PATH, [&](const string &name, bool is_directory) {
+		idx_t node_id;
+		if (is_directory && StringUtil::StartsWith(name, "node") &&
+		    TryCast::Operation<string_t, idx_t>(string_t(name.substr(4)), node_id)) {
+			node_ids.push_back(node_id);
+		}
+	});
+	std::sort(node_ids.begin(), node_ids.end());
+	for (auto &node_id : node_ids) {
+		auto cpu_list_path = StringUtil::Format("%s/node%llu/cpulist", NUMA_NODE_PATH, node_id);
+		if (!fs.FileExists(cpu_list_path)) {
+			continue;
+		}
+		auto cpus = ParseCPUList(ReadCPUList(fs, cpu_list_path));
+		if (cpus.empty()) {
+			// memory-only node
+			continue;
+		}
+		result.push_back(std::move(cpus));
+	}
+	return result;
+}
+
+#else
+
+vector<vector<idx_t>> NUMA::GetNodeCPUs(FileSystem &fs) {
+	return vector<vector<idx_t>>();
+}
+
+#endif
+
+} // namespace duckdb
@@ -423,6 +423,11 @@ ProgressData Sort::GetProgress(ClientContext &context, GlobalSourceState &gstate
 	return gstate.merger.GetProgress(context, *gstate.merger_global_state);
 }
 
+idx_t Sort::GetPartitionSize(GlobalSourceState &gstate_p) const {
+	auto &gstate = gstate_p.Cast<SortGlobalSourceState>();
+	return gstate.sink.partition_size;
+}
+
 OperatorPartitionData Sort::GetPartitionData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate_p,
                                              LocalSourceState &lstate_p,
                                              const OperatorPartitionInfo &partition_info) const {
@@ -62,6 +62,14 @@ void VirtualFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes
 	handle.file_system.Write(handle, buffer, nr_bytes, location);
 }
 
+void VirtualFileSystem::ReadBatch(FileHandle &handle, vector<FileIORequest> &requests) {
+	handle.file_system.ReadBatch(handle, requests);
+}
+
+bool VirtualFileSystem::SupportsConcurrentBatchRead(FileHandle &handle) {
+	return handle.file_system.SupportsConcurrentBatchRead(handle);
+}
+
 int64_t VirtualFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	return handle.file_system.Read(handle, buffer, nr_bytes);
 }
@@ -5,8 +5,13 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/ht_entry.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/settings.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
 namespace duckdb {
 
 using ValidityBytes = JoinHashTable::ValidityBytes;
@@ -30,6 +35,50 @@ JoinHashTable::InsertState::InsertState(const JoinHashTable &ht)
 	ht.data_collection->InitializeChunkState(chunk_state, ht.equality_predicate_columns);
 }
 
+//! Whether probe-side rows that do not find a match on the build side can be discarded (i.e., produce no output)
+static bool CanDiscardUnmatchedProbeRows(const JoinType join_type) {
+	switch (join_type) {
+	case JoinType::INNER:
+	case JoinType::RIGHT:
+	case JoinType::SEMI:
+	case JoinType::RIGHT_SEMI:
+	case JoinType::RIGHT_ANTI:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! Whether the join might go external, i.e., the estimated size of the build side is not far below the memory limit
+static bool MayGoExternal(ClientContext &context, const PhysicalOperator &op, const idx_t entry_size) {
+	// the estimate can be off by a lot, so we only rule out going external if the build side is estimated to be
+	// much smaller than the memory that the join can use
+	static constexpr idx_t ESTIMATE_SAFETY_FACTOR = 8;
+	if (ClientConfig::GetConfig(context).GetSetting<DebugForceExternalSetting>(context)) {
+		return true;
+	}
+	if (op.children.size() != 2) {
+		return true;
+	}
+	const auto estimated_count = op.children[1].get().estimated_cardinality;
+	const auto max_memory = BufferManager::GetBufferManager(context).GetQueryMaxMemory();
+	return estimated_count >= max_memory / MaxValue<idx_t>(entry_size * ESTIMATE_SAFETY_FACTOR, 1);
+}
+
+//! Whether the build side of a partition can be built in parts, each of which is probed with all probe-side rows
+static bool CanSplitPartitions(const JoinType join_type) {
+	switch (join_type) {
+	case JoinType::INNER:
+	case JoinType::RIGHT:
+	case JoinType::RIGHT_SEMI:
+	case JoinType::RIGHT_ANTI:
+		// every (probe, build) match is found exactly once, and build-side matches are tracked per build row
+		return true;
+	default:
+		return false;
+	}
+}
+
 JoinHashTable::JoinHashTable(ClientContext &context_p, const PhysicalOperator &op_p,
                              const vector<JoinCondition> &conditions_p, vector<LogicalType> btypes, JoinType type_p,
                              const vector<idx_t> &output_columns_p)
@@ -69,6 +118,21 @@ JoinHashTable::JoinHashTable(ClientContext &context_p, const PhysicalOperator &o
 	auto layout = make_shared_ptr<TupleDataLayout>();
 	vector<LogicalType> layout_types(condition_types);
 	layout_types.insert(layout_types.end(), build_types.begin(), build_types.end());
+	if (ClientConfig::GetConfig(context).dictionary_encode_join_payloads) {
+		// VARCHAR payload columns are stored as 4-byte dictionary codes
+		for (idx_t build_col_idx = 0; build_col_idx < build_types.size(); build_col_idx++) {
+			if (build_types[build_col_idx].id() != LogicalTypeId::VARCHAR) {
+				continue;
+			}
+			const auto col_idx = condition_types.size() + build_col_idx;
+			if (payload_dictionaries.empty()) {
+				payload_dictionaries.resize(condition_types.size() + build_types.size());
+				payload_dictionary_caches.resize(payload_dictionaries.size());
+			}
+			payload_dictionaries[col_idx] = make_shared_ptr<PayloadDictionary>(BufferAllocator::Get(context));
+			layout_types[col_idx] = LogicalType::UINTEGER;
+		}
+	}
 	if (PropagatesBuildSide(join_type)) {
 		// full/right outer joins need an extra bool to keep track of whether or not a tuple has found a matching entry
 		// we place the bool before the NEXT pointer
@@ -113,6 +177,12 @@ JoinHashTable::JoinHashTable(ClientContext &context_p, const PhysicalOperator &o
 		single_join_error_on_multiple_rows = config.scalar_subquery_error_on_multiple_rows;
 	}
 
+	// the key statistics are only used by external joins, don't pay for them for joins that will fit in memory
+	// if the estimate was wrong, they are collected from the partitions when the join goes external
+	if (MayGoExternal(context, op, entry_size)) {
+		key_statistics = make_uniq<PartitionKeyStatistics>(equality_types[0], null_values_are_equal[0]);
+	}
+
 	InitializePartitionMasks();
 }
 
@@ -123,6 +193,9 @@ void JoinHashTable::Merge(JoinHashTable &other) {
 	{
 		lock_guard<mutex> guard(data_lock);
 		data_collection->Combine(*other.data_collection);
+		if (key_statistics) {
+			key_statistics->Merge(*other.key_statistics);
+		}
 	}
 
 	if (join_type == JoinType::MARK) {
@@ -176,6 +249,30 @@ static void AddPointerToCompare(JoinHashTable::ProbeState &state, const ht_entry
 	keys_to_compare_count += 1;
 }
 
+static inline void PrefetchAddress(const void *address) {
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(address);
+#else
+	(void)address;
+#endif
+}
+
+static idx_t GetLastLevelCacheSize() {
+	static const idx_t last_level_cache_size = []() -> idx_t {
+#if defined(__linux__) && defined(_SC_LEVEL3_CACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE)
+		auto size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+		if (size <= 0) {
+			size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+		}
+		if (size > 0) {
+			return NumericCast<idx_t>(size);
+		}
+#endif
+		return JoinHashTable::DEFAULT_LAST_LEVEL_CACHE_SIZE;
+	}();
+	return last_level_cache_size;
+}
+
 template <bool USE_SALTS, bool HAS_SEL>
 static idx_t ProbeForPointersInternal(JoinHashTable::ProbeState &state, JoinHashTable &ht, ht_entry_t *entries,
                                       Vector &hashes_v, Vector &pointers_result_v, const SelectionVector *row_sel,
@@ -275,6 +372,14 @@ static void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &key_sta
 		VectorOperations::Copy(hashes_v, state.hashes_dense_v, count, 0, 0);
 	}
 
+	if (ht.prefetch_probes) {
+		// group prefetching: request the HT entries of the whole vector before probing any of them
+		const auto hashes_dense = FlatVector::GetData<hash_t>(state.hashes_dense_v);
+		for (idx_t i = 0; i < count; i++) {
+			PrefetchAddress(entries + (hashes_dense[i] & ht.bitmask));
+		}
+	}
+
 	// the number of keys that match for all iterations of the following loop
 	idx_t match_count = 0;
 
@@ -290,6 +395,14 @@ static void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &key_sta
 			break;
 		}
 
+		if (ht.prefetch_probes) {
+			// request the rows of the whole vector before comparing their keys
+			const auto row_pointers = FlatVector::GetData<data_ptr_t>(pointers_result_v);
+			for (idx_t i = 0; i < keys_to_compare_count; i++) {
+				PrefetchAddress(row_pointers[state.keys_to_compare_sel.get_index(i)]);
+			}
+		}
+
 		// Perform row comparisons, after Match function call salt_match_sel will point to the keys that match
 		keys_no_match_count = 0;
 		const idx_t keys_match_count =
@@ -428,7 +541,15 @@ void JoinHashTable::Build(PartitionedTupleDataAppendState &append_state, DataChu
 	idx_t col_offset = keys.ColumnCount();
 	D_ASSERT(build_types.size() == payload.ColumnCount());
 	for (idx_t i = 0; i < payload.ColumnCount(); i++) {
-		source_chunk.data[col_offset + i].Reference(payload.data[i]);
+		auto &source_vector = source_chunk.data[col_offset + i];
+		if (payload_dictionaries.empty() || !payload_dictionaries[col_offset + i]) {
+			source_vector.Reference(payload.data[i]);
+			continue;
+		}
+		// dictionary-encoded column: the source chunk owns the codes
+		source_vector.Initialize();
+		payload_dictionaries[col_offset + i]->Encode(payload.data[i], payload.size(), source_vector,
+		                                             payload_dictionary_caches[col_offset + i]);
 	}
 	col_offset += payload.ColumnCount();
 	if (PropagatesBuildSide(join_type)) {
@@ -458,6 +579,10 @@ void JoinHashTable::Build(PartitionedTupleDataAppendState &append_state, DataChu
 	// note that we only hash the keys used in the equality comparison
 	Hash(keys, *current_sel, added_count, hash_values);
 
+	if (key_statistics) {
+		key_statistics->Update(keys, hash_values, *current_sel, added_count);
+	}
+
 	// Re-reference and ToUnifiedFormat the hash column after computing it
 	source_chunk.data[col_offset].Reference(hash_values);
 	hash_values.ToUnifiedFormat(source_chunk.size(), append_state.chunk_state.vector_data.back().unified);
@@ -766,9 +891,15 @@ void JoinHashTable::AllocatePointerTable() {
 
 	bitmask = capacity - 1;
 
+	const auto size = data_collection->SizeInBytes() + hash_map.GetSize();
+	const auto cache_size = GetLastLevelCacheSize();
+	prefetch_probes = size > cache_size;
+
 	DUCKDB_LOG(context, PhysicalOperatorLogType, op, "JoinHashTable", "Build",
 	           {{"rows", to_string(data_collection->Count())},
-	            {"size", to_string(data_collection->SizeInBytes() + hash_map.GetSize())}});
+	            {"size", to_string(size)},
+	            {"cache_size", to_string(cache_size)},
+	            {"prefetch", prefetch_probes ? "true" : "false"}});
 }
 
 void JoinHashTable::InitializePointerTable(idx_t entry_idx_from, idx_t entry_idx_to) {
@@ -956,6 +1087,12 @@ void ScanStructure::AdvancePointers(const SelectionVector &sel, const idx_t sel_
 			this->sel_vector.set_index(new_count++, idx);
 		}
 	}
+	if (ht.prefetch_probes) {
+		// request the next rows of the chains before they are compared
+		for (idx_t i = 0; i < new_count; i++) {
+			PrefetchAddress(ptrs[this->sel_vector.get_index(i)]);
+		}
+	}
 	this->count = new_count;
 }
 
@@ -965,7 +1102,7 @@ void ScanStructure::AdvancePointers() {
 
 void ScanStructure::GatherResult(Vector &result, const SelectionVector &result_vector,
                                  const SelectionVector &sel_vector, const idx_t count, const idx_t col_no) {
-	ht.data_collection->Gather(pointers, sel_vector, count, col_no, result, result_vector, nullptr);
+	ht.GatherColumn(pointers, sel_vector, count, col_no, result, result_vector);
 }
 
 void ScanStructure::GatherResult(Vector &result, const SelectionVector &sel_vector, const idx_t count,
@@ -974,8 +1111,8 @@ void ScanStructure::GatherResult(Vector &result, const SelectionVector &sel_vect
 }
 
 void ScanStructure::GatherResult(Vector &result, const idx_t count, const idx_t col_idx) {
-	ht.data_collection->Gather(rhs_pointers, *FlatVector::IncrementalSelectionVector(), count, col_idx, result,
-	                           *FlatVector::IncrementalSelectionVector(), nullptr);
+	ht.GatherColumn(rhs_pointers, *FlatVector::IncrementalSelectionVector(), count, col_idx, result,
+	                *FlatVector::IncrementalSelectionVector());
 }
 
 void ScanStructure::UpdateCompactionBuffer(idx_t base_count, SelectionVector &result_vector, idx_t result_count) {
@@ -1038,7 +1175,7 @@ void ScanStructure::NextInnerJoin(DataChunk &keys, DataChunk &left, DataChunk &r
 					for (idx_t i = 0; i < ht.output_columns.size(); i++) {
 						auto &vector = result.data[left.ColumnCount() + i];
 						const auto output_col_idx = ht.output_columns[i];
-						D_ASSERT(vector.GetType() == ht.layout_ptr->GetTypes()[output_col_idx]);
+						D_ASSERT(vector.GetType() == ht.GetColumnType(output_col_idx));
 						GatherResult(vector, chain_match_sel_vector, result_count, output_col_idx);
 					}
 
@@ -1063,7 +1200,7 @@ void ScanStructure::NextInnerJoin(DataChunk &keys, DataChunk &left, DataChunk &r
 		for (idx_t i = 0; i < ht.output_columns.size(); i++) {
 			auto &vector = result.data[left.ColumnCount() + i];
 			const auto output_col_idx = ht.output_columns[i];
-			D_ASSERT(vector.GetType() == ht.layout_ptr->GetTypes()[output_col_idx]);
+			D_ASSERT(vector.GetType() == ht.GetColumnType(output_col_idx));
 			GatherResult(vector, base_count, output_col_idx);
 		}
 	}
@@ -1352,7 +1489,7 @@ void ScanStructure::NextSingleJoin(DataChunk &keys, DataChunk &left, DataChunk &
 			}
 		}
 		const auto output_col_idx = ht.output_columns[i];
-		D_ASSERT(vector.GetType() == ht.layout_ptr->GetTypes()[output_col_idx]);
+		D_ASSERT(vector.GetType() == ht.GetColumnType(output_col_idx));
 		GatherResult(vector, result_sel, result_sel, result_count, output_col_idx);
 	}
 	result.SetCardinality(left.size());
@@ -1438,8 +1575,8 @@ void JoinHashTable::ScanFullOuter(JoinHTScanState &state, Vector &addresses, Dat
 	for (idx_t i = 0; i < output_columns.size(); i++) {
 		auto &vector = result.data[left_column_count + i];
 		const auto output_col_idx = output_columns[i];
-		D_ASSERT(vector.GetType() == layout_ptr->GetTypes()[output_col_idx]);
-		data_collection->Gather(addresses, sel_vector, found_entries, output_col_idx, vector, sel_vector, nullptr);
+		D_ASSERT(vector.GetType() == GetColumnType(output_col_idx));
+		GatherColumn(addresses, sel_vector, found_entries, output_col_idx, vector, sel_vector);
 	}
 }
 
@@ -1486,7 +1623,7 @@ idx_t JoinHashTable::GetTotalSize(const vector<idx_t> &partition_sizes, const ve
 		return 0;
 	}
 
-	return total_size + PointerTableSize(total_count);
+	return total_size + PointerTableSize(total_count) + GetPayloadDictionarySize();
 }
 
 idx_t JoinHashTable::GetTotalSize(const vector<unique_ptr<JoinHashTable>> &local_hts, idx_t &max_partition_size,
@@ -1494,11 +1631,14 @@ idx_t JoinHashTable::GetTotalSize(const vector<unique_ptr<JoinHashTable>> &local
 	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
 	vector<idx_t> partition_sizes(num_partitions, 0);
 	vector<idx_t> partition_counts(num_partitions, 0);
+	idx_t cache_size = 0;
 	for (auto &ht : local_hts) {
 		ht->GetSinkCollection().GetSizesAndCounts(partition_sizes, partition_counts);
+		cache_size += ht->GetPayloadDictionaryCacheSize();
 	}
 
-	return GetTotalSize(partition_sizes, partition_counts, max_partition_size, max_partition_count);
+	const auto total_size = GetTotalSize(partition_sizes, partition_counts, max_partition_size, max_partition_count);
+	return total_size == 0 ? 0 : total_size + cache_size;
 }
 
 idx_t JoinHashTable::GetRemainingSize() const {
@@ -1514,8 +1654,47 @@ idx_t JoinHashTable::GetRemainingSize() const {
 		count += partitions[partition_idx]->Count();
 		data_size += partitions[partition_idx]->SizeInBytes();
 	}
+	for (auto &part : split_partition_parts) {
+		count += part->Count();
+		data_size += part->SizeInBytes();
+	}
 
-	return data_size + PointerTableSize(count);
+	return data_size + PointerTableSize(count) + GetPayloadDictionarySize();
+}
+
+idx_t JoinHashTable::GetPayloadDictionarySize() const {
+	idx_t size = 0;
+	for (auto &dictionary : payload_dictionaries) {
+		if (dictionary) {
+			size += dictionary->SizeInBytes();
+		}
+	}
+	return size;
+}
+
+idx_t JoinHashTable::GetPayloadDictionaryCacheSize() const {
+	idx_t entry_count = 0;
+	for (auto &cache : payload_dictionary_caches) {
+		entry_count += cache.size();
+	}
+	return entry_count * PayloadDictionary::LOCAL_CACHE_ENTRY_SIZE;
+}
+
+void JoinHashTable::SharePayloadDictionaries(const JoinHashTable &other) {
+	D_ASSERT(payload_dictionaries.size() == other.payload_dictionaries.size());
+	D_ASSERT(Count() == 0);
+	payload_dictionaries = other.payload_dictionaries;
+}
+
+void JoinHashTable::GatherColumn(Vector &row_locations, const SelectionVector &scan_sel, const idx_t scan_count,
+                                 const column_t column_id, Vector &result, const SelectionVector &target_sel) const {
+	if (payload_dictionaries.empty() || !payload_dictionaries[column_id]) {
+		data_collection->Gather(row_locations, scan_sel, scan_count, column_id, result, target_sel, nullptr);
+		return;
+	}
+	Vector codes(LogicalType::UINTEGER);
+	data_collection->Gather(row_locations, scan_sel, scan_count, column_id, codes, target_sel, nullptr);
+	payload_dictionaries[column_id]->Decode(codes, target_sel, scan_count, result);
 }
 
 void JoinHashTable::Unpartition() {
@@ -1592,6 +1771,17 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 		Reset();
 	}
 
+	if (!split_partition_parts.empty()) {
+		// Continue with the next part of the partition that was split
+		PrepareNextSplitPartitionPart();
+		return true;
+	}
+
+	if (!key_statistics) {
+		// the join was not expected to go external, collect the key statistics before the first partition is built
+		CollectKeyStatistics();
+	}
+
 	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
 	D_ASSERT(current_partitions.Capacity() == num_partitions);
 	D_ASSERT(completed_partitions.Capacity() == num_partitions);
@@ -1610,12 +1800,20 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 		if (completed_partitions.RowIsValidUnsafe(partition_idx)) {
 			continue;
 		}
+		if (CanDiscardUnmatchedProbeRows(join_type) && partitions[partition_idx]->Count() == 0) {
+			// probe rows without a match produce no output, and none of the probe rows of this partition were spilled
+			completed_partitions.SetValidUnsafe(partition_idx);
+			continue;
+		}
 		partition_indices.push_back(partition_idx);
 		// Keep track of min partition size
 		const auto size =
 		    partitions[partition_idx]->SizeInBytes() + PointerTableSize(partitions[partition_idx]->Count());
 		min_partition_size = MinValue(min_partition_size, size);
 	}
+	if (partition_indices.empty()) {
+		return false; // All remaining partitions are empty
+	}
 
 	// Sort partitions by size, from small to large
 	std::stable_sort(partition_indices.begin(), partition_indices.end(), [&](const idx_t &lhs, const idx_t &rhs) {
@@ -1627,6 +1825,21 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 		return lhs_size / min_partition_size < rhs_size / min_partition_size;
 	});
 
+	const auto first_partition_idx = partition_indices[0];
+	const auto &first_partition = *partitions[first_partition_idx];
+	if (first_partition.SizeInBytes() + PointerTableSize(first_partition.Count()) > max_ht_size) {
+		// Not even the smallest remaining partition fits, try to split it up using more radix bits
+		if (RepartitionOversizedPartition(first_partition_idx, max_ht_size)) {
+			return PrepareExternalFinalize(max_ht_size);
+		}
+		// Repartitioning does not help (e.g., a single key dominates the partition), build it in parts if we can
+		if (CanSplitPartitions(join_type)) {
+			SplitPartition(first_partition_idx, max_ht_size);
+			PrepareNextSplitPartitionPart();
+			return true;
+		}
+	}
+
 	// Determine which partitions should go next
 	idx_t count = 0;
 	idx_t data_size = 0;
@@ -1649,6 +1862,131 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 	return true;
 }
 
+bool JoinHashTable::RepartitionOversizedPartition(const idx_t partition_idx, const idx_t max_ht_size) {
+	if (radix_bits >= RadixPartitioning::MAX_RADIX_BITS) {
+		return false;
+	}
+
+	// Find the fewest radix bits that make the largest resulting partition fit, using the key statistics
+	const auto &partition = *sink_collection->GetPartitions()[partition_idx];
+	const auto count = partition.Count();
+	const auto size = static_cast<double>(partition.SizeInBytes());
+	idx_t new_radix_bits = radix_bits;
+	idx_t max_repartitioned_count = count;
+	bool fits = false;
+	while (!fits && new_radix_bits < RadixPartitioning::MAX_RADIX_BITS) {
+		new_radix_bits++;
+		max_repartitioned_count = key_statistics->MaxRepartitionedCount(radix_bits, partition_idx, new_radix_bits);
+		const auto fraction = static_cast<double>(max_repartitioned_count) / static_cast<double>(count);
+		const auto new_ht_size = size * fraction + static_cast<double>(PointerTableSize(max_repartitioned_count));
+		fits = new_ht_size <= static_cast<double>(max_ht_size);
+	}
+	if (!fits && static_cast<double>(max_repartitioned_count) >= HEAVY_HITTER_THRESHOLD * static_cast<double>(count)) {
+		return false; // Most of the partition stays together, no point in repartitioning
+	}
+
+	// Remember which partitions were completed, the new partitions are sub-partitions of the old ones
+	const auto added_bits = new_radix_bits - radix_bits;
+	const auto old_num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
+	vector<bool> old_completed_partitions(old_num_partitions);
+	for (idx_t old_partition_idx = 0; old_partition_idx < old_num_partitions; old_partition_idx++) {
+		old_completed_partitions[old_partition_idx] = completed_partitions.RowIsValidUnsafe(old_partition_idx);
+	}
+
+	DUCKDB_LOG(context, PhysicalOperatorLogType, op, "JoinHashTable", "Repartition",
+	           {{"partitions_before", to_string(old_num_partitions)},
+	            {"partitions_after", to_string(RadixPartitioning::NumberOfPartitions(new_radix_bits))}});
+	radix_bits = new_radix_bits;
+	auto new_sink_collection =
+	    make_uniq<RadixPartitionedTupleData>(buffer_manager, layout_ptr, radix_bits, layout_ptr->ColumnCount() - 1);
+	sink_collection->Repartition(context, *new_sink_collection);
+	sink_collection = std::move(new_sink_collection);
+
+	InitializePartitionMasks();
+	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
+	for (idx_t new_partition_idx = 0; new_partition_idx < num_partitions; new_partition_idx++) {
+		if (old_completed_partitions[new_partition_idx >> added_bits]) {
+			completed_partitions.SetValidUnsafe(new_partition_idx);
+		}
+	}
+	return true;
+}
+
+void JoinHashTable::CollectKeyStatistics() {
+	key_statistics = make_uniq<PartitionKeyStatistics>(equality_types[0], null_values_are_equal[0]);
+	const vector<column_t> column_ids {0, layout_ptr->ColumnCount() - 1};
+	for (auto &partition : sink_collection->GetPartitions()) {
+		TupleDataScanState scan_state;
+		partition->InitializeScan(scan_state, column_ids);
+		DataChunk chunk;
+		partition->InitializeScanChunk(scan_state, chunk);
+		while (partition->Scan(scan_state, chunk)) {
+			if (context.interrupted) {
+				throw InterruptException();
+			}
+			key_statistics->Update(chunk, chunk.data[1], *FlatVector::IncrementalSelectionVector(), chunk.size());
+		}
+	}
+}
+
+void JoinHashTable::SplitPartition(const idx_t partition_idx, const idx_t max_ht_size) {
+	D_ASSERT(split_partition_parts.empty());
+	auto &partition = *sink_collection->GetPartitions()[partition_idx];
+	const auto count = partition.Count();
+	const auto size = partition.SizeInBytes();
+
+	// Find the number of parts so that every part fits
+	idx_t part_count = MaxValue<idx_t>((size + PointerTableSize(count)) / MaxValue<idx_t>(max_ht_size, 1), 2);
+	while (part_count < count && size / part_count + PointerTableSize(count / part_count) > max_ht_size) {
+		part_count++;
+	}
+	const auto part_row_count = (count + part_count - 1) / part_count;
+
+	// Scan the partition and append it to the parts, the partition is destroyed while scanning
+	TupleDataScanState scan_state;
+	partition.InitializeScan(scan_state, TupleDataPinProperties::DESTROY_AFTER_DONE);
+	DataChunk chunk;
+	partition.InitializeScanChunk(scan_state, chunk);
+
+	unique_ptr<TupleDataCollection> part;
+	TupleDataAppendState append_state;
+	while (partition.Scan(scan_state, chunk)) {
+		if (context.interrupted) {
+			throw InterruptException();
+		}
+		if (!part || part->Count() >= part_row_count) {
+			if (part) {
+				part->FinalizePinState(append_state.pin_state);
+				split_partition_parts.push_back(std::move(part));
+			}
+			part = make_uniq<TupleDataCollection>(buffer_manager, layout_ptr);
+			part->InitializeAppend(append_state);
+		}
+		part->Append(append_state, chunk);
+	}
+	if (part) {
+		part->FinalizePinState(append_state.pin_state);
+		split_partition_parts.push_back(std::move(part));
+	}
+	partition.Reset();
+
+	DUCKDB_LOG(context, PhysicalOperatorLogType, op, "JoinHashTable", "SplitPartition",
+	           {{"partition", to_string(partition_idx)},
+	            {"rows", to_string(count)},
+	            {"size", to_string(size)},
+	            {"parts", to_string(split_partition_parts.size())}});
+	split_partition_idx = partition_idx;
+	// Already mark as done, the remaining parts are tracked in "split_partition_parts"
+	completed_partitions.SetValidUnsafe(partition_idx);
+}
+
+void JoinHashTable::PrepareNextSplitPartitionPart() {
+	D_ASSERT(!split_partition_parts.empty());
+	data_collection->Combine(std::move(split_partition_parts.back()));
+	split_partition_parts.pop_back();
+	current_partitions.SetValidUnsafe(split_partition_idx);
+}
+
 void JoinHashTable::ProbeAndSpill(ScanStructure &scan_structure, DataChunk &probe_keys, TupleDataChunkState &key_state,
                                   ProbeState &probe_state, DataChunk &probe_chunk, ProbeSpill &probe_spill,
                                   ProbeSpillLocalAppendState &spill_state, DataChunk &spill_chunk) {
@@ -1662,7 +2000,11 @@ void JoinHashTable::ProbeAndSpill(ScanStructure &scan_structure, DataChunk &prob
 	const auto true_count =
 	    RadixPartitioning::Select(hashes, FlatVector::IncrementalSelectionVector(), probe_keys.size(), radix_bits,
 	                              current_partitions, &true_sel, &false_sel);
-	const auto false_count = probe_keys.size() - true_count;
+	auto false_count = probe_keys.size() - true_count;
+	if (CanDiscardUnmatchedProbeRows(join_type)) {
+		// don't spill rows that cannot find a match on the build side (e.g., their partition is empty)
+		false_count = key_statistics->SelectCanMatch(probe_keys, hashes, false_sel, false_count, false_sel);
+	}
 
 	// can't probe these values right now, append to spill
 	spill_chunk.Reset();
@@ -1671,6 +2013,23 @@ void JoinHashTable::ProbeAndSpill(ScanStructure &scan_structure, DataChunk &prob
 	spill_chunk.Slice(false_sel, false_count);
 	probe_spill.Append(spill_chunk, spill_state);
 
+	if (!split_partition_parts.empty()) {
+		// only part of the split partition is built, its rows also have to be probed against the remaining parts
+		const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
+		ValidityMask split_partition_mask;
+		split_partition_mask.Initialize(num_partitions);
+		split_partition_mask.SetAllInvalid(num_partitions);
+		split_partition_mask.SetValidUnsafe(split_partition_idx);
+		SelectionVector split_sel(STANDARD_VECTOR_SIZE);
+		const auto split_count = RadixPartitioning::Select(hashes, &true_sel, true_count, radix_bits,
+		                                                   split_partition_mask, &split_sel, nullptr);
+		spill_chunk.Reset();
+		spill_chunk.Reference(probe_chunk);
+		spill_chunk.data.back().Reference(hashes);
+		spill_chunk.Slice(split_sel, split_count);
+		probe_spill.Append(spill_chunk, spill_state);
+	}
+
 	// slice the stuff we CAN probe right now
 	hashes.Slice(true_sel, true_count);
 	probe_keys.Slice(true_sel, true_count);
@@ -1727,6 +2086,9 @@ void ProbeSpill::Finalize() {
 
 void ProbeSpill::PrepareNextProbe() {
 	global_spill_collection.reset();
+	if (global_partitions->Cast<RadixPartitionedColumnData>().GetRadixBits() != ht.radix_bits) {
+		Repartition();
+	}
 	auto &partitions = global_partitions->GetPartitions();
 	if (partitions.empty() || ht.current_partitions.CheckAllInvalid(partitions.size())) {
 		// Can't probe, just make an empty one
@@ -1739,6 +2101,16 @@ void ProbeSpill::PrepareNextProbe() {
 				continue;
 			}
 			auto &partition = partitions[partition_idx];
+			if (partition_idx == ht.split_partition_idx && !ht.split_partition_parts.empty()) {
+				// the remaining parts of the split partition also need these rows, probe a copy
+				auto copy = make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), probe_types);
+				for (auto &chunk : partition->Chunks()) {
+					copy->Append(chunk);
+				}
+				D_ASSERT(!global_spill_collection);
+				global_spill_collection = std::move(copy);
+				continue;
+			}
 			if (!global_spill_collection) {
 				global_spill_collection = std::move(partition);
 			} else if (partition->Count() != 0) {
@@ -1751,4 +2123,306 @@ void ProbeSpill::PrepareNextProbe() {
 	consumer->InitializeScan();
 }
 
+void ProbeSpill::Repartition() {
+	auto new_partitions =
+	    make_uniq<RadixPartitionedColumnData>(context, probe_types, ht.radix_bits, probe_types.size() - 1);
+	PartitionedColumnDataAppendState append_state;
+	new_partitions->InitializeAppendState(append_state);
+	for (auto &partition : global_partitions->GetPartitions()) {
+		if (!partition) {
+			continue; // Already probed
+		}
+		for (auto &chunk : partition->Chunks()) {
+			if (context.interrupted) {
+				throw InterruptException();
+			}
+			new_partitions->Append(append_state, chunk);
+		}
+		partition.reset();
+	}
+	new_partitions->FlushAppendState(append_state);
+	global_partitions = std::move(new_partitions);
+}
+
+static idx_t KeyStatisticsPartition(const hash_t hash) {
+	static constexpr idx_t RADIX_BITS = JoinHashTable::PartitionKeyStatistics::RADIX_BITS;
+	return (hash & RadixPartitioning::Mask(RADIX_BITS)) >> RadixPartitioning::Shift(RADIX_BITS);
+}
+
+static bool KeyStatisticsHasMinMax(const PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+		return true;
+	default:
+		return false;
+	}
+}
+
+JoinHashTable::PartitionKeyStatistics::PartitionKeyStatistics(const LogicalType &key_type_p, bool nulls_are_equal_p)
+    : key_type(key_type_p.InternalType()), nulls_are_equal(nulls_are_equal_p),
+      has_min_max(KeyStatisticsHasMinMax(key_type)), counts(RadixPartitioning::NumberOfPartitions(RADIX_BITS), 0) {
+	if (has_min_max) {
+		min.resize(counts.size(), NumericLimits<int64_t>::Maximum());
+		max.resize(counts.size(), NumericLimits<int64_t>::Minimum());
+	}
+}
+
+template <class T>
+static void UpdateKeyStatistics(const UnifiedVectorFormat &key_format, const UnifiedVectorFormat &hash_format,
+                                const SelectionVector &sel, const idx_t count, idx_t *counts, int64_t *min,
+                                int64_t *max) {
+	const auto keys = UnifiedVectorFormat::GetData<T>(key_format);
+	const auto hashes = UnifiedVectorFormat::GetData<hash_t>(hash_format);
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = sel.get_index(i);
+		const auto partition_idx = KeyStatisticsPartition(hashes[hash_format.sel->get_index(idx)]);
+		counts[partition_idx]++;
+		if (!min) {
+			continue;
+		}
+		const auto key_idx = key_format.sel->get_index(idx);
+		if (!key_format.validity.RowIsValid(key_idx)) {
+			continue;
+		}
+		const auto key = static_cast<int64_t>(keys[key_idx]);
+		min[partition_idx] = MinValue(min[partition_idx], key);
+		max[partition_idx] = MaxValue(max[partition_idx], key);
+	}
+}
+
+void JoinHashTable::PartitionKeyStatistics::Update(DataChunk &keys, Vector &hashes, const SelectionVector &sel,
+                                                   const idx_t count) {
+	UnifiedVectorFormat key_format;
+	keys.data[0].ToUnifiedFormat(keys.size(), key_format);
+	UnifiedVectorFormat hash_format;
+	hashes.ToUnifiedFormat(keys.size(), hash_format);
+
+	auto min_data = has_min_max ? min.data() : nullptr;
+	auto max_data = has_min_max ? max.data() : nullptr;
+	switch (key_type) {
+	case PhysicalType::INT8:
+		UpdateKeyStatistics<int8_t>(key_format, hash_format, sel, count, counts.data(), min_data, max_data);
+		break;
+	case PhysicalType::INT16:
+		UpdateKeyStatistics<int16_t>(key_format, hash_format, sel, count, counts.data(), min_data, max_data);
+		break;
+	case PhysicalType::INT32:
+		UpdateKeyStatistics<int32_t>(key_format, hash_format, sel, count, counts.data(), min_data, max_data);
+		break;
+	case PhysicalType::INT64:
+		UpdateKeyStatistics<int64_t>(key_format, hash_format, sel, count, counts.data(), min_data, max_data);
+		break;
+	case PhysicalType::UINT8:
+		UpdateKeyStatistics<uint8_t>(key_format, hash_format, sel, count, counts.data(), min_data, max_data);
+		break;
+	case PhysicalType::UINT16:
+		UpdateKeyStatistics<uint16_t>(key_format, hash_format, sel, count, counts.data(), min_data, max_data);
+		break;
+	case PhysicalType::UINT32:
+		UpdateKeyStatistics<uint32_t>(key_format, hash_format, sel, count, counts.data(), min_data, max_data);
+		break;
+	default:
+		// only the counts are tracked, the key type is irrelevant
+		D_ASSERT(!has_min_max);
+		UpdateKeyStatistics<int8_t>(key_format, hash_format, sel, count, counts.data(), nullptr, nullptr);
+		break;
+	}
+}
+
+idx_t JoinHashTable::PartitionKeyStatistics::MaxRepartitionedCount(const idx_t radix_bits, const idx_t partition_idx,
+                                                                   const idx_t new_radix_bits) const {
+	D_ASSERT(radix_bits <= new_radix_bits && new_radix_bits <= RADIX_BITS);
+	// The statistics are kept at more radix bits, so each (new) partition covers a contiguous range of them
+	const auto begin = partition_idx << (RADIX_BITS - radix_bits);
+	const auto end = (partition_idx + 1) << (RADIX_BITS - radix_bits);
+	const auto new_partition_width = idx_t(1) << (RADIX_BITS - new_radix_bits);
+	idx_t result = 0;
+	for (idx_t new_begin = begin; new_begin < end; new_begin += new_partition_width) {
+		idx_t new_count = 0;
+		for (idx_t stats_idx = new_begin; stats_idx < new_begin + new_partition_width; stats_idx++) {
+			new_count += counts[stats_idx];
+		}
+		result = MaxValue(result, new_count);
+	}
+	return result;
+}
+
+void JoinHashTable::PartitionKeyStatistics::Merge(const PartitionKeyStatistics &other) {
+	D_ASSERT(counts.size() == other.counts.size());
+	for (idx_t partition_idx = 0; partition_idx < counts.size(); partition_idx++) {
+		counts[partition_idx] += other.counts[partition_idx];
+	}
+	if (!has_min_max) {
+		return;
+	}
+	for (idx_t partition_idx = 0; partition_idx < counts.size(); partition_idx++) {
+		min[partition_idx] = MinValue(min[partition_idx], other.min[partition_idx]);
+		max[partition_idx] = MaxValue(max[partition_idx], other.max[partition_idx]);
+	}
+}
+
+template <class T>
+static idx_t SelectCanMatchKeys(const UnifiedVectorFormat &key_format, const UnifiedVectorFormat &hash_format,
+                                const SelectionVector &sel, const idx_t count, const bool nulls_are_equal,
+                                const idx_t *counts, const int64_t *min, const int64_t *max,
+                                SelectionVector &result) {
+	const auto keys = UnifiedVectorFormat::GetData<T>(key_format);
+	const auto hashes = UnifiedVectorFormat::GetData<hash_t>(hash_format);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = sel.get_index(i);
+		const auto partition_idx = KeyStatisticsPartition(hashes[hash_format.sel->get_index(idx)]);
+		if (counts[partition_idx] == 0) {
+			continue; // no build-side rows in this partition
+		}
+		const auto key_idx = key_format.sel->get_index(idx);
+		if (!key_format.validity.RowIsValid(key_idx)) {
+			if (nulls_are_equal) {
+				result.set_index(result_count++, idx);
+			}
+			continue;
+		}
+		if (min) {
+			const auto key = static_cast<int64_t>(keys[key_idx]);
+			if (key < min[partition_idx] || key > max[partition_idx]) {
+				continue; // key is outside of the range of the build-side keys in this partition
+			}
+		}
+		result.set_index(result_count++, idx);
+	}
+	return result_count;
+}
+
+idx_t JoinHashTable::PartitionKeyStatistics::SelectCanMatch(DataChunk &keys, Vector &hashes, const SelectionVector &sel,
+                                                            const idx_t count, SelectionVector &result) const {
+	UnifiedVectorFormat key_format;
+	keys.data[0].ToUnifiedFormat(keys.size(), key_format);
+	UnifiedVectorFormat hash_format;
+	hashes.ToUnifiedFormat(keys.size(), hash_format);
+
+	auto min_data = has_min_max ? min.data() : nullptr;
+	auto max_data = has_min_max ? max.data() : nullptr;
+	switch (key_type) {
+	case PhysicalType::INT8:
+		return SelectCanMatchKeys<int8_t>(key_format, hash_format, sel, count, nulls_are_equal, counts.data(),
+		                                  min_data, max_data, result);
+	case PhysicalType::INT16:
+		return SelectCanMatchKeys<int16_t>(key_format, hash_format, sel, count, nulls_are_equal, counts.data(),
+		                                   min_data, max_data, result);
+	case PhysicalType::INT32:
+		return SelectCanMatchKeys<int32_t>(key_format, hash_format, sel, count, nulls_are_equal, counts.data(),
+		                                   min_data, max_data, result);
+	case PhysicalType::INT64:
+		return SelectCanMatchKeys<int64_t>(key_format, hash_format, sel, count, nulls_are_equal, counts.data(),
+		                                   min_data, max_data, result);
+	case PhysicalType::UINT8:
+		return SelectCanMatchKeys<uint8_t>(key_format, hash_format, sel, count, nulls_are_equal, counts.data(),
+		                                   min_data, max_data, result);
+	case PhysicalType::UINT16:
+		return SelectCanMatchKeys<uint16_t>(key_format, hash_format, sel, count, nulls_are_equal, counts.data(),
+		                                    min_data, max_data, result);
+	case PhysicalType::UINT32:
+		return SelectCanMatchKeys<uint32_t>(key_format, hash_format, sel, count, nulls_are_equal, counts.data(),
+		                                    min_data, max_data, result);
+	default:
+		D_ASSERT(!has_min_max);
+		return SelectCanMatchKeys<int8_t>(key_format, hash_format, sel, count, nulls_are_equal, counts.data(),
+		                                  nullptr, nullptr, result);
+	}
+}
+
+JoinHashTable::PayloadDictionary::PayloadDictionary(Allocator &allocator)
+    : strings(make_buffer<VectorStringBuffer>(allocator)), size_in_bytes(0) {
+}
+
+void JoinHashTable::PayloadDictionary::Encode(Vector &input, const idx_t count, Vector &result,
+                                              string_map_t<uint32_t> &local_cache) {
+	UnifiedVectorFormat input_format;
+	input.ToUnifiedFormat(count, input_format);
+	const auto input_data = UnifiedVectorFormat::GetData<string_t>(input_format);
+
+	D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<uint32_t>(result);
+	auto &result_validity = FlatVector::Validity(result);
+
+	// first try to encode using the thread-local cache
+	SelectionVector miss_sel;
+	idx_t miss_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = input_format.sel->get_index(i);
+		if (!input_format.validity.RowIsValid(idx)) {
+			result_validity.SetInvalid(i);
+			continue;
+		}
+		auto it = local_cache.find(input_data[idx]);
+		if (it != local_cache.end()) {
+			result_data[i] = it->second;
+			continue;
+		}
+		if (miss_count == 0) {
+			miss_sel.Initialize(STANDARD_VECTOR_SIZE);
+		}
+		miss_sel.set_index(miss_count++, i);
+	}
+	if (miss_count == 0) {
+		return;
+	}
+
+	// lock the dictionary to encode the remaining strings
+	lock_guard<mutex> guard(lock);
+	for (idx_t miss_idx = 0; miss_idx < miss_count; miss_idx++) {
+		const auto i = miss_sel.get_index(miss_idx);
+		const auto &str = input_data[input_format.sel->get_index(i)];
+		uint32_t code;
+		auto it = codes.find(str);
+		if (it == codes.end()) {
+			if (entries.size() == NumericLimits<uint32_t>::Maximum()) {
+				throw OutOfRangeException("Too many distinct strings to dictionary-encode a join payload column");
+			}
+			code = NumericCast<uint32_t>(entries.size());
+			// inlined strings are self-contained, other strings are copied into the dictionary
+			entries.push_back(str.IsInlined() ? str : strings->AddBlob(str));
+			codes.emplace(entries.back(), code);
+			size_in_bytes += (str.IsInlined() ? 0 : str.GetSize()) + 2 * sizeof(string_t) + sizeof(uint32_t);
+		} else {
+			code = it->second;
+		}
+		// the cached string is owned by the dictionary, which outlives this HT's cache
+		if (local_cache.size() >= MAX_LOCAL_CACHE_ENTRIES) {
+			local_cache.clear();
+		}
+		local_cache.emplace(entries[code], code);
+		result_data[i] = code;
+	}
+}
+
+void JoinHashTable::PayloadDictionary::Decode(Vector &input, const SelectionVector &sel, const idx_t count,
+                                              Vector &result) const {
+	D_ASSERT(input.GetVectorType() == VectorType::FLAT_VECTOR);
+	const auto input_data = FlatVector::GetData<uint32_t>(input);
+	const auto &input_validity = FlatVector::Validity(input);
+
+	auto result_data = FlatVector::GetData<string_t>(result);
+	auto &result_validity = FlatVector::Validity(result);
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = sel.get_index(i);
+		if (!input_validity.RowIsValid(idx)) {
+			result_validity.SetInvalid(idx);
+			continue;
+		}
+		result_data[idx] = entries[input_data[idx]];
+	}
+	StringVector::AddBuffer(result, strings);
+}
+
+idx_t JoinHashTable::PayloadDictionary::SizeInBytes() const {
+	return size_in_bytes;
+}
+
 } // namespace duckdb
@@ -64,6 +64,9 @@ bool ExtractNumericValue(Value val, hugeint_t &result) {
 }
 
 bool PerfectHashJoinExecutor::CanDoPerfectHashJoin(const PhysicalHashJoin &op, const Value &min, const Value &max) {
+	if (ht.HasPayloadDictionaries()) {
+		return false; // The perfect hash join gathers the payload directly from the HT, without decoding it
+	}
 	if (perfect_join_statistics.is_build_small) {
 		return true; // Already true based on static statistics
 	}
@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 
+#include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/types/value_map.hpp"
 #include "duckdb/execution/expression_executor.hpp"
@@ -17,6 +18,7 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/optional_filter.hpp"
@@ -225,6 +227,7 @@ public:
 		}
 
 		hash_table = op.InitializeHashTable(context);
+		hash_table->SharePayloadDictionaries(*gstate.hash_table);
 		hash_table->GetSinkCollection().InitializeAppendState(append_state);
 
 		gstate.active_local_states++;
@@ -699,12 +702,8 @@ public:
 	}
 };
 
-void JoinFilterPushdownInfo::PushInFilter(const JoinFilterPushdownFilter &info, JoinHashTable &ht,
-                                          const PhysicalOperator &op, idx_t filter_idx, idx_t filter_col_idx) const {
-	// generate a "OR" filter (i.e. x=1 OR x=535 OR x=997)
-	// first scan the entire vector at the probe side
+static Vector ScanBuildKeys(JoinHashTable &ht, idx_t build_idx, idx_t &key_count) {
 	// FIXME: this code is duplicated from PerfectHashJoinExecutor::FullScanHashTable
-	auto build_idx = join_condition[filter_idx];
 	auto &data_collection = ht.GetDataCollection();
 
 	Vector tuples_addresses(LogicalType::POINTER, ht.Count()); // allocate space for all the tuples
@@ -713,12 +712,21 @@ void JoinFilterPushdownInfo::PushInFilter(const JoinFilterPushdownFilter &info,
 	                              TupleDataPinProperties::KEEP_EVERYTHING_PINNED);
 
 	// Go through all the blocks and fill the keys addresses
-	idx_t key_count = ht.FillWithHTOffsets(join_ht_state, tuples_addresses);
+	key_count = ht.FillWithHTOffsets(join_ht_state, tuples_addresses);
 
 	// Scan the build keys in the hash table
 	Vector build_vector(ht.layout_ptr->GetTypes()[build_idx], key_count);
 	data_collection.Gather(tuples_addresses, *FlatVector::IncrementalSelectionVector(), key_count, build_idx,
 	                       build_vector, *FlatVector::IncrementalSelectionVector(), nullptr);
+	return build_vector;
+}
+
+bool JoinFilterPushdownInfo::PushInFilter(const JoinFilterPushdownFilter &info, JoinHashTable &ht,
+                                          const PhysicalOperator &op, idx_t filter_idx, idx_t filter_col_idx) const {
+	// generate a "OR" filter (i.e. x=1 OR x=535 OR x=997)
+	// first scan the entire vector at the probe side
+	idx_t key_count;
+	auto build_vector = ScanBuildKeys(ht, join_condition[filter_idx], key_count);
 
 	// generate the OR-clause - note that we only need to consider unique values here (so we use a seT)
 	value_set_t unique_ht_values;
@@ -731,7 +739,7 @@ void JoinFilterPushdownInfo::PushInFilter(const JoinFilterPushdownFilter &info,
 	// not dense and that the range does not contain NULL
 	// i.e. if we have the values [0, 1, 2, 3, 4] - the min/max is fully equivalent to the OR filter
 	if (FilterCombiner::ContainsNull(in_list) || FilterCombiner::IsDenseRange(in_list)) {
-		return;
+		return false;
 	}
 
 	// generate the OR filter
@@ -741,7 +749,49 @@ void JoinFilterPushdownInfo::PushInFilter(const JoinFilterPushdownFilter &info,
 	// the IN-list is expensive to execute otherwise
 	auto filter = make_uniq<OptionalFilter>(std::move(in_filter));
 	info.dynamic_filters->PushFilter(op, filter_col_idx, std::move(filter));
-	return;
+	return true;
+}
+
+static bool IsDenseMinMaxRange(const Value &min_val, const Value &max_val, idx_t count) {
+	// if the build side covers (almost) every value between min and max, the range filter is already exact
+	auto &type = min_val.type();
+	if (!type.IsIntegral() || type == LogicalType::UHUGEINT) {
+		return false;
+	}
+	hugeint_t range;
+	if (!TrySubtractOperator::Operation(max_val.GetValue<hugeint_t>(), min_val.GetValue<hugeint_t>(), range)) {
+		return false;
+	}
+	return range < hugeint_t(NumericCast<int64_t>(count)) * hugeint_t(2);
+}
+
+void JoinFilterPushdownInfo::PushBloomFilter(const JoinFilterPushdownFilter &info, JoinHashTable &ht,
+                                             const PhysicalOperator &op, idx_t filter_idx,
+                                             idx_t filter_col_idx) const {
+	// build a Bloom filter over the hashes of the build-side keys
+	// the probe-side scan hashes its rows with the same hash function and skips the ones that are not in the filter
+	idx_t key_count;
+	auto build_vector = ScanBuildKeys(ht, join_condition[filter_idx], key_count);
+
+	auto bloom_filter = make_shared_ptr<BlockedBloomFilter>(key_count);
+	Vector hashes(LogicalType::HASH);
+	for (idx_t offset = 0; offset < key_count; offset += STANDARD_VECTOR_SIZE) {
+		auto next = MinValue<idx_t>(offset + STANDARD_VECTOR_SIZE, key_count);
+		auto count = next - offset;
+		Vector keys(build_vector, offset, next);
+		UnifiedVectorFormat key_data;
+		keys.ToUnifiedFormat(count, key_data);
+		VectorOperations::Hash(keys, hashes, count);
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < count; i++) {
+			if (!key_data.validity.RowIsValid(key_data.sel->get_index(i))) {
+				// NULL keys never match, they do not need to be in the filter
+				continue;
+			}
+			bloom_filter->Insert(hash_data[i]);
+		}
+	}
+	info.dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<BloomFilter>(std::move(bloom_filter)));
 }
 
 unique_ptr<DataChunk> JoinFilterPushdownInfo::Finalize(ClientContext &context, optional_ptr<JoinHashTable> ht,
@@ -780,9 +830,15 @@ unique_ptr<DataChunk> JoinFilterPushdownInfo::Finalize(ClientContext &context, o
 			}
 			// if the HT is small we can generate a complete "OR" filter
 			// but only if the join condition is equality.
+			bool pushed_in_filter = false;
 			if (ht && ht->Count() > 1 && ht->Count() <= dynamic_or_filter_threshold &&
 			    cmp == ExpressionType::COMPARE_EQUAL) {
-				PushInFilter(info, *ht, op, filter_idx, filter_col_idx);
+				pushed_in_filter = PushInFilter(info, *ht, op, filter_idx, filter_col_idx);
+			}
+			// otherwise, push a Bloom filter of the build keys into the probe-side scan
+			if (!pushed_in_filter && ht && ht->Count() > 1 && ht->Count() <= BloomFilter::MAX_BUILD_COUNT &&
+			    cmp == ExpressionType::COMPARE_EQUAL && !IsDenseMinMaxRange(min_val, max_val, ht->Count())) {
+				PushBloomFilter(info, *ht, op, filter_idx, filter_col_idx);
 			}
 
 			if (Value::NotDistinctFrom(min_val, max_val)) {
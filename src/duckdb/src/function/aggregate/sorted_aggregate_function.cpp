@@ -1,13 +1,15 @@
 #include "duckdb/common/numeric_utils.hpp"
-#include "duckdb/common/sort/sort.hpp"
+#include "duckdb/common/sorting/sort.hpp"
 #include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/common/types/list_segment.hpp"
+#include "duckdb/execution/execution_context.hpp"
 #include "duckdb/function/aggregate_function.hpp"
 #include "duckdb/function/function_binder.hpp"
+#include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_window_expression.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
-#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/parser/expression_map.hpp"
 
 namespace duckdb {
@@ -21,8 +23,7 @@ struct SortedAggregateBindData : public FunctionData {
 	SortedAggregateBindData(ClientContext &context_p, Expressions &children, AggregateFunction &aggregate,
 	                        BindInfoPtr &bind_info, OrderBys &order_bys)
 	    : context(context_p), function(aggregate), bind_info(std::move(bind_info)),
-	      threshold(ClientConfig::GetConfig(context).ordered_aggregate_threshold),
-	      external(ClientConfig::GetConfig(context).force_external) {
+	      threshold(ClientConfig::GetConfig(context).ordered_aggregate_threshold) {
 		arg_types.reserve(children.size());
 		arg_funcs.reserve(children.size());
 		for (const auto &child : children) {
@@ -57,7 +58,7 @@ struct SortedAggregateBindData : public FunctionData {
 	SortedAggregateBindData(const SortedAggregateBindData &other)
 	    : context(other.context), function(other.function), arg_types(other.arg_types), arg_funcs(other.arg_funcs),
 	      sort_types(other.sort_types), sort_funcs(other.sort_funcs), sorted_on_args(other.sorted_on_args),
-	      threshold(other.threshold), external(other.external) {
+	      threshold(other.threshold) {
 		if (other.bind_info) {
 			bind_info = other.bind_info->Copy();
 		}
@@ -106,7 +107,92 @@ struct SortedAggregateBindData : public FunctionData {
 
 	//! The sort flush threshold
 	const idx_t threshold;
-	const bool external;
+};
+
+//! Sorts the buffered inputs of a batch of states on (state index, orders) using the Sort engine
+class SortedAggregateSorter {
+public:
+	explicit SortedAggregateSorter(const SortedAggregateBindData &order_bind)
+	    : context(order_bind.context), thread(context), execution(context, thread, nullptr) {
+		// The input is laid out as (state index, sort columns, [argument columns])
+		vector<BoundOrderByNode> orders;
+		input_types.emplace_back(LogicalType::USMALLINT);
+		orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_FIRST,
+		                    make_uniq<BoundReferenceExpression>(LogicalType::USMALLINT, storage_t(0)));
+		for (idx_t i = 0; i < order_bind.orders.size(); i++) {
+			const auto &order = order_bind.orders[i];
+			const auto &sort_type = order_bind.sort_types[i];
+			input_types.emplace_back(sort_type);
+			orders.emplace_back(order.type, order.null_order,
+			                    make_uniq<BoundReferenceExpression>(sort_type, NumericCast<storage_t>(i + 1)));
+		}
+
+		// The output only contains the arguments, which are the sort columns if we sort on the arguments
+		vector<idx_t> projection_map;
+		const auto arg_offset = input_types.size();
+		for (idx_t i = 0; i < order_bind.arg_types.size(); i++) {
+			if (order_bind.sorted_on_args) {
+				projection_map.push_back(i + 1);
+			} else {
+				input_types.emplace_back(order_bind.arg_types[i]);
+				projection_map.push_back(arg_offset + i);
+			}
+		}
+
+		sort = make_uniq<Sort>(context, orders, input_types, std::move(projection_map));
+		Reset();
+	}
+
+	void Sink(DataChunk &input) {
+		if (!input.size()) {
+			return;
+		}
+		OperatorSinkInput sink_input {*global_sink, *local_sink, interrupt_state};
+		sort->Sink(execution, input, sink_input);
+	}
+
+	//! Sort the sunk input so that it can be scanned
+	void Finalize() {
+		OperatorSinkCombineInput combine_input {*global_sink, *local_sink, interrupt_state};
+		sort->Combine(execution, combine_input);
+		OperatorSinkFinalizeInput finalize_input {*global_sink, interrupt_state};
+		sort->Finalize(context, finalize_input);
+
+		global_source = sort->GetGlobalSourceState(context, *global_sink);
+		local_source = sort->GetLocalSourceState(execution, *global_source);
+	}
+
+	//! Scan the next chunk of sorted arguments, returns false if there are no more
+	bool Scan(DataChunk &chunk) {
+		chunk.Reset();
+		OperatorSourceInput source_input {*global_source, *local_source, interrupt_state};
+		sort->GetData(execution, chunk, source_input);
+		return chunk.size() > 0;
+	}
+
+	//! Start a new sort
+	void Reset() {
+		local_source.reset();
+		global_source.reset();
+		global_sink = sort->GetGlobalSinkState(context);
+		local_sink = sort->GetLocalSinkState(execution);
+	}
+
+public:
+	ClientContext &context;
+	//! The types of the input chunks
+	vector<LogicalType> input_types;
+
+private:
+	ThreadContext thread;
+	ExecutionContext execution;
+	InterruptState interrupt_state;
+
+	unique_ptr<Sort> sort;
+	unique_ptr<GlobalSinkState> global_sink;
+	unique_ptr<LocalSinkState> local_sink;
+	unique_ptr<GlobalSourceState> global_source;
+	unique_ptr<LocalSourceState> local_source;
 };
 
 struct SortedAggregateState {
@@ -381,30 +467,36 @@ struct SortedAggregateState {
 	}
 
 	void PrefixSortBuffer(DataChunk &prefixed) {
+		column_t prefixed_idx = 1;
 		for (column_t col_idx = 0; col_idx < sort_chunk->ColumnCount(); ++col_idx) {
-			prefixed.data[col_idx + 1].Reference(sort_chunk->data[col_idx]);
+			prefixed.data[prefixed_idx++].Reference(sort_chunk->data[col_idx]);
+		}
+		if (arg_chunk) {
+			for (column_t col_idx = 0; col_idx < arg_chunk->ColumnCount(); ++col_idx) {
+				prefixed.data[prefixed_idx++].Reference(arg_chunk->data[col_idx]);
+			}
 		}
 		prefixed.SetCardinality(*sort_chunk);
 	}
 
-	void Finalize(const SortedAggregateBindData &order_bind, DataChunk &prefixed, LocalSortState &local_sort) {
+	void Finalize(const SortedAggregateBindData &order_bind, DataChunk &prefixed, SortedAggregateSorter &sorter) {
 		if (arguments) {
 			ColumnDataScanState sort_state;
 			ordering->InitializeScan(sort_state);
 			ColumnDataScanState arg_state;
 			arguments->InitializeScan(arg_state);
 			for (sort_chunk->Reset(); ordering->Scan(sort_state, *sort_chunk); sort_chunk->Reset()) {
-				PrefixSortBuffer(prefixed);
 				arg_chunk->Reset();
 				arguments->Scan(arg_state, *arg_chunk);
-				local_sort.SinkChunk(prefixed, *arg_chunk);
+				PrefixSortBuffer(prefixed);
+				sorter.Sink(prefixed);
 			}
 		} else if (ordering) {
 			ColumnDataScanState sort_state;
 			ordering->InitializeScan(sort_state);
 			for (sort_chunk->Reset(); ordering->Scan(sort_state, *sort_chunk); sort_chunk->Reset()) {
 				PrefixSortBuffer(prefixed);
-				local_sort.SinkChunk(prefixed, *sort_chunk);
+				sorter.Sink(prefixed);
 			}
 		} else {
 			//	Force chunks so we can sort
@@ -413,11 +505,7 @@ struct SortedAggregateState {
 			}
 
 			PrefixSortBuffer(prefixed);
-			if (arg_chunk) {
-				local_sort.SinkChunk(prefixed, *arg_chunk);
-			} else {
-				local_sort.SinkChunk(prefixed, *sort_chunk);
-			}
+			sorter.Sink(prefixed);
 		}
 
 		Reset();
@@ -565,10 +653,6 @@ struct SortedAggregateFunction {
 	static void Finalize(Vector &states, AggregateInputData &aggr_input_data, Vector &result, idx_t count,
 	                     const idx_t offset) {
 		auto &order_bind = aggr_input_data.bind_data->Cast<SortedAggregateBindData>();
-		auto &context = order_bind.context;
-		RowLayout payload_layout;
-		payload_layout.Initialize(order_bind.arg_types);
-
 		auto &buffer_allocator = BufferManager::GetBufferManager(order_bind.context).GetBufferAllocator();
 		DataChunk chunk;
 		chunk.Initialize(buffer_allocator, order_bind.arg_types);
@@ -599,20 +683,10 @@ struct SortedAggregateFunction {
 		}
 
 		// Sort the input payloads on (state_idx ASC, orders)
-		vector<BoundOrderByNode> orders;
-		orders.emplace_back(BoundOrderByNode(OrderType::ASCENDING, OrderByNullType::NULLS_FIRST,
-		                                     make_uniq<BoundConstantExpression>(Value::USMALLINT(0))));
-		for (const auto &order : order_bind.orders) {
-			orders.emplace_back(order.Copy());
-		}
-
-		auto global_sort = make_uniq<GlobalSortState>(context, orders, payload_layout);
-		global_sort->external = order_bind.external;
-		auto local_sort = make_uniq<LocalSortState>();
-		local_sort->Initialize(*global_sort, global_sort->buffer_manager);
+		SortedAggregateSorter sorter(order_bind);
 
 		DataChunk prefixed;
-		prefixed.Initialize(buffer_allocator, global_sort->sort_layout.logical_types);
+		prefixed.Initialize(buffer_allocator, sorter.input_types);
 
 		//	Go through the states accumulating values to sort until we hit the sort threshold
 		idx_t unsorted_count = 0;
@@ -622,7 +696,7 @@ struct SortedAggregateFunction {
 				auto state = sdata[finalized];
 				prefixed.Reset();
 				prefixed.data[0].Reference(Value::USMALLINT(UnsafeNumericCast<uint16_t>(finalized)));
-				state->Finalize(order_bind, prefixed, *local_sort);
+				state->Finalize(order_bind, prefixed, sorter);
 				unsorted_count += state_unprocessed[finalized];
 
 				// Go to the next aggregate unless this is the last one
@@ -638,20 +712,10 @@ struct SortedAggregateFunction {
 			}
 
 			//	Sort all the data
-			global_sort->AddLocalState(*local_sort);
-			global_sort->PrepareMergePhase();
-			while (global_sort->sorted_blocks.size() > 1) {
-				global_sort->InitializeMergeRound();
-				MergeSorter merge_sorter(*global_sort, global_sort->buffer_manager);
-				merge_sorter.PerformInMergeRound();
-				global_sort->CompleteMergeRound(false);
-			}
+			sorter.Finalize();
 
-			auto scanner = make_uniq<PayloadScanner>(*global_sort);
 			initialize(aggr, agg_state.data());
-			while (scanner->Remaining()) {
-				chunk.Reset();
-				scanner->Scan(chunk);
+			while (sorter.Scan(chunk)) {
 				idx_t consumed = 0;
 
 				// Distribute the scanned chunk to the aggregates
@@ -702,11 +766,7 @@ struct SortedAggregateFunction {
 			}
 
 			//	Create a new sort
-			scanner.reset();
-			global_sort = make_uniq<GlobalSortState>(context, orders, payload_layout);
-			global_sort->external = order_bind.external;
-			local_sort = make_uniq<LocalSortState>();
-			local_sort->Initialize(*global_sort, global_sort->buffer_manager);
+			sorter.Reset();
 			unsorted_count = 0;
 		}
 
@@ -1,5 +1,7 @@
 #include "duckdb/function/pragma/pragma_functions.hpp"
 
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/enums/output_type.hpp"
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/function/function_set.hpp"
@@ -8,9 +10,12 @@
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/parser/parsed_data/alter_table_info.hpp"
+#include "duckdb/parser/qualified_name.hpp"
 #include "duckdb/planner/expression_binder.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/transaction/meta_transaction.hpp"
 #include "duckdb/common/encryption_functions.hpp"
 
 #include <cctype>
@@ -153,6 +158,41 @@ static void PragmaDisableOptimizer(ClientContext &context, const FunctionParamet
 	ClientConfig::GetConfig(context).enable_optimizer = false;
 }
 
+static void PragmaSetBloomFilter(ClientContext &context, const FunctionParameters &parameters, bool bloom_filter) {
+	if (parameters.values[0].IsNull() || parameters.values[1].IsNull()) {
+		throw InvalidInputException("Bloom filter table and column names cannot be NULL");
+	}
+	auto qname = QualifiedName::Parse(parameters.values[0].ToString());
+	auto column_name = parameters.values[1].ToString();
+
+	// the declaration is stored with the (fully qualified) table in the catalog, so it is persisted and replayed
+	auto &table = Catalog::GetEntry<TableCatalogEntry>(context, qname.catalog, qname.schema, qname.name);
+	auto &catalog = table.ParentCatalog();
+	auto &db = catalog.GetAttached();
+	if (db.IsReadOnly()) {
+		throw InvalidInputException(
+		    "Cannot alter the Bloom filters of database \"%s\" which is attached in read-only mode!", db.GetName());
+	}
+	// the declaration is logged to the WAL as a SET_BLOOM_FILTER alter, which older versions cannot read
+	auto &storage = db.GetStorageManager();
+	if (!storage.InMemory() && storage.GetStorageVersion() < 6) {
+		throw InvalidInputException("Bloom filters are only supported with STORAGE_VERSION '1.4.0' or above.\nExplicitly "
+		                            "specify a newer storage version when creating the database to use Bloom filters");
+	}
+	MetaTransaction::Get(context).ModifyDatabase(db);
+	AlterEntryData data(catalog.GetName(), table.ParentSchema().name, table.name, OnEntryNotFound::THROW_EXCEPTION);
+	SetBloomFilterInfo info(std::move(data), std::move(column_name), bloom_filter);
+	catalog.Alter(context, info);
+}
+
+static void PragmaCreateBloomFilter(ClientContext &context, const FunctionParameters &parameters) {
+	PragmaSetBloomFilter(context, parameters, true);
+}
+
+static void PragmaDropBloomFilter(ClientContext &context, const FunctionParameters &parameters) {
+	PragmaSetBloomFilter(context, parameters, false);
+}
+
 void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 	RegisterEnableProfiling(set);
 
@@ -185,6 +225,11 @@ void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 
 	set.AddFunction(PragmaFunction::PragmaStatement("force_checkpoint", PragmaForceCheckpoint));
 
+	set.AddFunction(PragmaFunction::PragmaCall("create_bloom_filter", PragmaCreateBloomFilter,
+	                                           {LogicalType::VARCHAR, LogicalType::VARCHAR}));
+	set.AddFunction(PragmaFunction::PragmaCall("drop_bloom_filter", PragmaDropBloomFilter,
+	                                           {LogicalType::VARCHAR, LogicalType::VARCHAR}));
+
 	set.AddFunction(PragmaFunction::PragmaStatement("truncate_duckdb_logs", PragmaTruncateDuckDBLogs));
 
 	set.AddFunction(PragmaFunction::PragmaStatement("enable_progress_bar", PragmaEnableProgressBar));
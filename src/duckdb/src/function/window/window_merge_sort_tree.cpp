@@ -1,5 +1,5 @@
 #include "duckdb/function/window/window_merge_sort_tree.hpp"
-#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 
 #include <thread>
 #include <utility>
@@ -7,9 +7,10 @@
 namespace duckdb {
 
 WindowMergeSortTree::WindowMergeSortTree(ClientContext &context, const vector<BoundOrderByNode> &orders,
-                                         const vector<column_t> &sort_idx, const idx_t count, bool unique)
-    : context(context), memory_per_thread(PhysicalOperator::GetMaxThreadMemory(context)), sort_idx(sort_idx),
-      build_stage(PartitionSortStage::INIT), tasks_completed(0) {
+                                         const vector<column_t> &sort_idx, const idx_t count, bool unique,
+                                         bool project_keys)
+    : context(context), sort_idx(sort_idx), build_stage(PartitionSortStage::INIT), tasks_completed(0),
+      sort_count(0) {
 	// Sort the unfiltered indices by the orders
 	const auto force_external = ClientConfig::GetConfig(context).force_external;
 	LogicalType index_type;
@@ -21,89 +22,87 @@ WindowMergeSortTree::WindowMergeSortTree(ClientContext &context, const vector<Bo
 		mst64 = make_uniq<MergeSortTree64>();
 	}
 
-	vector<LogicalType> payload_types;
-	payload_types.emplace_back(index_type);
-
-	RowLayout payload_layout;
-	payload_layout.Initialize(payload_types);
-
+	//	The sort input is (sort columns, row indices), and the orders reference the sort columns
+	vector<BoundOrderByNode> sort_orders;
+	for (const auto &order : orders) {
+		const auto &type = order.expression->return_type;
+		auto expr = make_uniq<BoundReferenceExpression>(type, sort_types.size());
+		sort_orders.emplace_back(order.type, order.null_order, std::move(expr));
+		sort_types.emplace_back(type);
+	}
+	const auto index_col = sort_types.size();
+	sort_types.emplace_back(index_type);
 	if (unique) {
-		vector<BoundOrderByNode> unique_orders;
-		for (const auto &order : orders) {
-			unique_orders.emplace_back(order.Copy());
+		//	Break ties with the row indices
+		auto unique_expr = make_uniq<BoundReferenceExpression>(index_type, index_col);
+		sort_orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST, std::move(unique_expr));
+	}
+
+	//	The output is the row indices, optionally followed by the (decoded) sort keys
+	vector<idx_t> projection_map(1, index_col);
+	sorted_types.emplace_back(index_type);
+	if (project_keys) {
+		for (idx_t col_idx = 0; col_idx < orders.size(); ++col_idx) {
+			projection_map.emplace_back(col_idx);
+			sorted_types.emplace_back(sort_types[col_idx]);
 		}
-		auto unique_expr = make_uniq<BoundConstantExpression>(Value(index_type));
-		const auto order_type = OrderType::ASCENDING;
-		const auto order_by_type = OrderByNullType::NULLS_LAST;
-		unique_orders.emplace_back(BoundOrderByNode(order_type, order_by_type, std::move(unique_expr)));
-		global_sort = make_uniq<GlobalSortState>(context, unique_orders, payload_layout);
-	} else {
-		global_sort = make_uniq<GlobalSortState>(context, orders, payload_layout);
 	}
-	global_sort->external = force_external;
+
+	sort = make_uniq<duckdb::Sort>(context, sort_orders, sort_types, std::move(projection_map));
+	global_sink = sort->GetGlobalSinkState(context);
 }
 
-optional_ptr<LocalSortState> WindowMergeSortTree::AddLocalSort() {
+optional_ptr<LocalSinkState> WindowMergeSortTree::AddLocalSort(ExecutionContext &execution) {
 	lock_guard<mutex> local_sort_guard(lock);
-	auto local_sort = make_uniq<LocalSortState>();
-	local_sort->Initialize(*global_sort, global_sort->buffer_manager);
-	local_sorts.emplace_back(std::move(local_sort));
+	local_sorts.emplace_back(sort->GetLocalSinkState(execution));
 
 	return local_sorts.back().get();
 }
 
 WindowMergeSortTreeLocalState::WindowMergeSortTreeLocalState(WindowMergeSortTree &window_tree)
-    : window_tree(window_tree) {
-	sort_chunk.Initialize(window_tree.context, window_tree.global_sort->sort_layout.logical_types);
-	payload_chunk.Initialize(window_tree.context, window_tree.global_sort->payload_layout.GetTypes());
-	local_sort = window_tree.AddLocalSort();
+    : window_tree(window_tree), thread(window_tree.context), execution(window_tree.context, thread, nullptr) {
+	sort_chunk.Initialize(window_tree.context, window_tree.sort_types);
+	sorted_chunk.Initialize(window_tree.context, window_tree.sorted_types);
+	local_sink = window_tree.AddLocalSort(execution);
 }
 
 void WindowMergeSortTreeLocalState::SinkChunk(DataChunk &chunk, const idx_t row_idx,
                                               optional_ptr<SelectionVector> filter_sel, idx_t filtered) {
-	//	Sequence the payload column
-	auto &indices = payload_chunk.data[0];
-	payload_chunk.SetCardinality(chunk);
-	indices.Sequence(int64_t(row_idx), 1, payload_chunk.size());
-
 	//	Reference the sort columns
+	sort_chunk.Reset();
 	auto &sort_idx = window_tree.sort_idx;
 	for (column_t c = 0; c < sort_idx.size(); ++c) {
 		sort_chunk.data[c].Reference(chunk.data[sort_idx[c]]);
 	}
-	// Add the row numbers if we are uniquifying
-	if (sort_idx.size() < sort_chunk.ColumnCount()) {
-		sort_chunk.data[sort_idx.size()].Reference(indices);
-	}
+
+	//	Sequence the row indices
+	auto &indices = sort_chunk.data[sort_idx.size()];
+	indices.Sequence(int64_t(row_idx), 1, chunk.size());
 	sort_chunk.SetCardinality(chunk);
 
 	//	Apply FILTER clause, if any
 	if (filter_sel) {
 		sort_chunk.Slice(*filter_sel, filtered);
-		payload_chunk.Slice(*filter_sel, filtered);
 	}
-
-	local_sort->SinkChunk(sort_chunk, payload_chunk);
-
-	//	Flush if we have too much data
-	if (local_sort->SizeInBytes() > window_tree.memory_per_thread) {
-		local_sort->Sort(*window_tree.global_sort, true);
+	if (!sort_chunk.size()) {
+		return;
 	}
+
+	window_tree.sort_count += sort_chunk.size();
+	OperatorSinkInput sink_input {*window_tree.global_sink, *local_sink, interrupt_state};
+	window_tree.sort->Sink(execution, sort_chunk, sink_input);
 }
 
 void WindowMergeSortTreeLocalState::ExecuteSortTask() {
 	switch (build_stage) {
-	case PartitionSortStage::SCAN:
-		window_tree.global_sort->AddLocalState(*window_tree.local_sorts[build_task]);
-		break;
-	case PartitionSortStage::MERGE: {
-		auto &global_sort = *window_tree.global_sort;
-		MergeSorter merge_sorter(global_sort, global_sort.buffer_manager);
-		merge_sorter.PerformInMergeRound();
+	case PartitionSortStage::SCAN: {
+		OperatorSinkCombineInput combine_input {*window_tree.global_sink, *window_tree.local_sorts[build_task],
+		                                        interrupt_state};
+		window_tree.sort->Combine(execution, combine_input);
 		break;
 	}
 	case PartitionSortStage::SORTED:
-		BuildLeaves();
+		ScanSorted();
 		break;
 	default:
 		break;
@@ -113,13 +112,8 @@ void WindowMergeSortTreeLocalState::ExecuteSortTask() {
 }
 
 idx_t WindowMergeSortTree::MeasurePayloadBlocks() {
-	const auto &blocks = global_sort->sorted_blocks[0]->payload_data->data_blocks;
-	idx_t count = 0;
-	for (const auto &block : blocks) {
-		block_starts.emplace_back(count);
-		count += block->count;
-	}
-	block_starts.emplace_back(count);
+	const idx_t count = sort_count;
+	partition_size = sort->GetPartitionSize(*global_source);
 
 	// Allocate the leaves.
 	if (mst32) {
@@ -133,37 +127,51 @@ idx_t WindowMergeSortTree::MeasurePayloadBlocks() {
 	return count;
 }
 
-void WindowMergeSortTreeLocalState::BuildLeaves() {
-	auto &global_sort = *window_tree.global_sort;
-	if (global_sort.sorted_blocks.empty()) {
-		return;
-	}
+void WindowMergeSortTreeLocalState::ScanSorted() {
+	auto &sort = *window_tree.sort;
+	auto &global_source = *window_tree.global_source;
+	auto local_source = sort.GetLocalSourceState(execution, global_source);
+	OperatorSourceInput source_input {global_source, *local_source, interrupt_state};
+	const auto partition_info = OperatorPartitionInfo::BatchIndex();
 
-	PayloadScanner scanner(global_sort, build_task);
-	idx_t row_idx = window_tree.block_starts[build_task];
+	//	The sort hands out whole partitions of partition_size rows, so the batch index gives the sorted position
+	optional_idx partition_idx;
+	idx_t row_idx = 0;
 	for (;;) {
-		payload_chunk.Reset();
-		scanner.Scan(payload_chunk);
-		const auto count = payload_chunk.size();
-		if (count == 0) {
+		sorted_chunk.Reset();
+		sort.GetData(execution, sorted_chunk, source_input);
+		if (!sorted_chunk.size()) {
 			break;
 		}
-		auto &indices = payload_chunk.data[0];
-		if (window_tree.mst32) {
-			auto &sorted = window_tree.mst32->LowestLevel();
-			auto data = FlatVector::GetData<uint32_t>(indices);
-			std::copy(data, data + count, sorted.data() + row_idx);
-		} else {
-			auto &sorted = window_tree.mst64->LowestLevel();
-			auto data = FlatVector::GetData<uint64_t>(indices);
-			std::copy(data, data + count, sorted.data() + row_idx);
+		const auto batch_idx =
+		    sort.GetPartitionData(execution, sorted_chunk, global_source, *local_source, partition_info).batch_index;
+		if (!partition_idx.IsValid() || partition_idx.GetIndex() != batch_idx) {
+			partition_idx = batch_idx;
+			row_idx = batch_idx * window_tree.partition_size;
 		}
-		row_idx += count;
+		BuildLeaves(sorted_chunk, row_idx);
+		row_idx += sorted_chunk.size();
+	}
+}
+
+void WindowMergeSortTreeLocalState::BuildLeaves(DataChunk &sorted, const idx_t row_idx) {
+	const auto count = sorted.size();
+	auto &indices = sorted.data[0];
+	indices.Flatten(count);
+	if (window_tree.mst32) {
+		auto &leaves = window_tree.mst32->LowestLevel();
+		auto data = FlatVector::GetData<uint32_t>(indices);
+		std::copy(data, data + count, leaves.data() + row_idx);
+	} else {
+		auto &leaves = window_tree.mst64->LowestLevel();
+		auto data = FlatVector::GetData<uint64_t>(indices);
+		std::copy(data, data + count, leaves.data() + row_idx);
 	}
 }
 
 void WindowMergeSortTree::CleanupSort() {
-	global_sort.reset();
+	global_source.reset();
+	global_sink.reset();
 	local_sorts.clear();
 }
 
@@ -186,50 +194,23 @@ bool WindowMergeSortTree::TryPrepareSortStage(WindowMergeSortTreeLocalState &lst
 			return true;
 		} else if (tasks_completed < tasks_assigned) {
 			return false;
-		}
-		global_sort->PrepareMergePhase();
-		if (!(global_sort->sorted_blocks.size() / 2)) {
-			if (global_sort->sorted_blocks.empty()) {
+		} else {
+			InterruptState interrupt_state;
+			OperatorSinkFinalizeInput finalize_input {*global_sink, interrupt_state};
+			if (sort->Finalize(context, finalize_input) == SinkFinalizeType::NO_OUTPUT_POSSIBLE) {
+				CleanupSort();
 				lstate.build_stage = build_stage = PartitionSortStage::FINISHED;
 				return true;
 			}
-			MeasurePayloadBlocks();
-			total_tasks = block_starts.size() - 1;
-			tasks_completed = 0;
-			tasks_assigned = 0;
-			lstate.build_stage = build_stage = PartitionSortStage::SORTED;
-			lstate.build_task = tasks_assigned++;
-			return true;
 		}
-		global_sort->InitializeMergeRound();
-		lstate.build_stage = build_stage = PartitionSortStage::MERGE;
-		total_tasks = local_sorts.size();
-		tasks_assigned = 1;
-		tasks_completed = 0;
-		return true;
-	case PartitionSortStage::MERGE:
-		if (tasks_assigned < total_tasks) {
-			lstate.build_stage = PartitionSortStage::MERGE;
-			++tasks_assigned;
-			return true;
-		} else if (tasks_completed < tasks_assigned) {
-			return false;
-		}
-		global_sort->CompleteMergeRound(true);
-		if (!(global_sort->sorted_blocks.size() / 2)) {
-			MeasurePayloadBlocks();
-			total_tasks = block_starts.size() - 1;
-			tasks_completed = 0;
-			tasks_assigned = 0;
-			lstate.build_stage = build_stage = PartitionSortStage::SORTED;
-			lstate.build_task = tasks_assigned++;
-			return true;
-		}
-		global_sort->InitializeMergeRound();
-		lstate.build_stage = PartitionSortStage::MERGE;
-		total_tasks = local_sorts.size();
-		tasks_assigned = 1;
+		//	The sorted runs are merged while they are scanned, one partition per thread at a time
+		global_source = sort->GetGlobalSourceState(context, *global_sink);
+		MeasurePayloadBlocks();
+		total_tasks = MinValue<idx_t>(local_sorts.size(), global_source->MaxThreads());
 		tasks_completed = 0;
+		tasks_assigned = 0;
+		lstate.build_stage = build_stage = PartitionSortStage::SORTED;
+		lstate.build_task = tasks_assigned++;
 		return true;
 	case PartitionSortStage::SORTED:
 		if (tasks_assigned < total_tasks) {
@@ -5,48 +5,96 @@ namespace duckdb {
 class WindowTokenTreeLocalState : public WindowMergeSortTreeLocalState {
 public:
 	explicit WindowTokenTreeLocalState(WindowTokenTree &token_tree)
-	    : WindowMergeSortTreeLocalState(token_tree), token_tree(token_tree) {
+	    : WindowMergeSortTreeLocalState(token_tree), token_tree(token_tree), prev_sel(STANDARD_VECTOR_SIZE),
+	      curr_sel(STANDARD_VECTOR_SIZE), peer_sel(STANDARD_VECTOR_SIZE), next_peer_sel(STANDARD_VECTOR_SIZE) {
 	}
 	//! Process sorted leaf data
-	void BuildLeaves() override;
+	void BuildLeaves(DataChunk &sorted, const idx_t row_idx) override;
 
 	WindowTokenTree &token_tree;
+	//! The sort keys of the last row of the previous chunk
+	vector<Value> prev_keys;
+	//! Selections of the adjacent rows in a chunk
+	SelectionVector prev_sel;
+	SelectionVector curr_sel;
+	//! Selections of the adjacent rows that are still peers
+	SelectionVector peer_sel;
+	SelectionVector next_peer_sel;
 };
 
-void WindowTokenTreeLocalState::BuildLeaves() {
-	auto &global_sort = *token_tree.global_sort;
-	if (global_sort.sorted_blocks.empty()) {
-		return;
+static void GetPeerKeys(DataChunk &sorted, const idx_t row, vector<Value> &keys) {
+	//	The sort keys follow the row indices
+	keys.clear();
+	for (column_t col_idx = 1; col_idx < sorted.ColumnCount(); ++col_idx) {
+		keys.emplace_back(sorted.data[col_idx].GetValue(row));
 	}
+}
 
-	//	Scan the sort keys and note deltas
-	SBIterator curr(global_sort, ExpressionType::COMPARE_LESSTHAN);
-	SBIterator prev(global_sort, ExpressionType::COMPARE_LESSTHAN);
-	const auto &sort_layout = global_sort.sort_layout;
+static bool ArePeers(const vector<Value> &lhs, const vector<Value> &rhs) {
+	D_ASSERT(lhs.size() == rhs.size());
+	for (idx_t col_idx = 0; col_idx < lhs.size(); ++col_idx) {
+		if (!Value::NotDistinctFrom(lhs[col_idx], rhs[col_idx])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void WindowTokenTreeLocalState::BuildLeaves(DataChunk &sorted, const idx_t row_idx) {
+	//	Record the row indices in sorted order
+	WindowMergeSortTreeLocalState::BuildLeaves(sorted, row_idx);
 
-	const auto block_begin = token_tree.block_starts.at(build_task);
-	const auto block_end = token_tree.block_starts.at(build_task + 1);
 	auto &deltas = token_tree.deltas;
-	if (!block_begin) {
-		// First block, so set up initial delta
-		deltas[0] = 0;
+	const auto count = sorted.size();
+	if (sorted.ColumnCount() == 1) {
+		//	Unique sorts have no peers
+		std::fill(deltas.begin() + NumericCast<int64_t>(row_idx),
+		          deltas.begin() + NumericCast<int64_t>(row_idx + count), uint8_t(1));
+		if (!row_idx) {
+			deltas[0] = 0;
+		}
+		return;
+	}
+
+	//	The partitions are scanned by different threads,
+	//	so the first rows of the partitions are compared in CleanupSort.
+	const auto partition_size = token_tree.partition_size;
+	const auto partition_idx = row_idx / partition_size;
+	if (row_idx % partition_size == 0) {
+		GetPeerKeys(sorted, 0, token_tree.partition_firsts[partition_idx]);
+		deltas[row_idx] = 0;
 	} else {
-		// Move to the to end of the previous block
-		// so we can record the comparison result for the first row
-		curr.SetIndex(block_begin - 1);
-		prev.SetIndex(block_begin - 1);
+		vector<Value> first_keys;
+		GetPeerKeys(sorted, 0, first_keys);
+		deltas[row_idx] = !ArePeers(prev_keys, first_keys);
 	}
 
-	for (++curr; curr.GetIndex() < block_end; ++curr, ++prev) {
-		int lt = 0;
-		if (sort_layout.all_constant) {
-			lt = FastMemcmp(prev.entry_ptr, curr.entry_ptr, sort_layout.comparison_size);
-		} else {
-			lt = Comparators::CompareTuple(prev.scan, curr.scan, prev.entry_ptr, curr.entry_ptr, sort_layout,
-			                               prev.external);
+	//	Compare the adjacent rows in the chunk, narrowing down the peers column by column
+	if (count > 1) {
+		const auto pair_count = count - 1;
+		for (idx_t i = 0; i < pair_count; ++i) {
+			prev_sel.set_index(i, i);
+			curr_sel.set_index(i, i + 1);
+			deltas[row_idx + i + 1] = 1;
+		}
+		optional_ptr<const SelectionVector> sel;
+		idx_t peer_count = pair_count;
+		for (column_t col_idx = 1; col_idx < sorted.ColumnCount() && peer_count; ++col_idx) {
+			Vector prev(sorted.data[col_idx], prev_sel, pair_count);
+			Vector curr(sorted.data[col_idx], curr_sel, pair_count);
+			auto &peers = (sel.get() == &peer_sel) ? next_peer_sel : peer_sel;
+			peer_count = VectorOperations::NotDistinctFrom(prev, curr, sel, peer_count, &peers, nullptr);
+			sel = &peers;
+		}
+		for (idx_t i = 0; i < peer_count; ++i) {
+			deltas[row_idx + sel->get_index(i) + 1] = 0;
 		}
+	}
 
-		deltas[curr.GetIndex()] = (lt != 0);
+	GetPeerKeys(sorted, count - 1, prev_keys);
+	const auto row_end = row_idx + count;
+	if (row_end % partition_size == 0 || row_end == deltas.size()) {
+		token_tree.partition_lasts[partition_idx] = prev_keys;
 	}
 }
 
@@ -54,32 +102,24 @@ idx_t WindowTokenTree::MeasurePayloadBlocks() {
 	const auto count = WindowMergeSortTree::MeasurePayloadBlocks();
 
 	deltas.resize(count);
+	if (sorted_types.size() > 1) {
+		const auto partition_count = (count + partition_size - 1) / partition_size;
+		partition_firsts.resize(partition_count);
+		partition_lasts.resize(partition_count);
+	}
 
 	return count;
 }
 
 template <typename T>
 static void BuildTokens(WindowTokenTree &token_tree, vector<T> &tokens) {
-	PayloadScanner scanner(*token_tree.global_sort);
-	DataChunk payload_chunk;
-	payload_chunk.Initialize(token_tree.context, token_tree.global_sort->payload_layout.GetTypes());
-	const T *row_idx = nullptr;
-	idx_t i = 0;
+	//	The leaves hold the row indices in sorted order, so replace them with the tokens of the rows
+	const vector<T> sorted(tokens);
 
 	T token = 0;
-	for (auto &d : token_tree.deltas) {
-		if (i >= payload_chunk.size()) {
-			payload_chunk.Reset();
-			scanner.Scan(payload_chunk);
-			if (!payload_chunk.size()) {
-				break;
-			}
-			row_idx = FlatVector::GetDataUnsafe<T>(payload_chunk.data[0]);
-			i = 0;
-		}
-
-		token += d;
-		tokens[row_idx[i++]] = token;
+	for (idx_t i = 0; i < sorted.size(); ++i) {
+		token += token_tree.deltas[i];
+		tokens[sorted[i]] = token;
 	}
 }
 
@@ -88,6 +128,15 @@ unique_ptr<WindowAggregatorState> WindowTokenTree::GetLocalState() {
 }
 
 void WindowTokenTree::CleanupSort() {
+	//	Compare the rows at the partition boundaries
+	for (idx_t partition_idx = 1; partition_idx < partition_firsts.size(); ++partition_idx) {
+		const auto &prev_keys = partition_lasts[partition_idx - 1];
+		const auto &first_keys = partition_firsts[partition_idx];
+		deltas[partition_idx * partition_size] = !ArePeers(prev_keys, first_keys);
+	}
+	vector<vector<Value>>().swap(partition_firsts);
+	vector<vector<Value>>().swap(partition_lasts);
+
 	//	Convert the deltas to tokens
 	if (mst64) {
 		BuildTokens(*this, mst64->LowestLevel());
@@ -128,6 +128,9 @@ public:
 	static void ThreadIdle();
 	static void FlushAll();
 	static void SetBackgroundThreads(bool enable);
+	//! Makes the calling thread allocate from an arena that is shared only with threads of the same NUMA node
+	//! (jemalloc only). Combined with pinning the thread to the node, memory that the arena reuses stays on the node
+	static void SetThreadNUMANode(idx_t numa_node);
 
 private:
 	allocate_function_ptr_t allocate_function;
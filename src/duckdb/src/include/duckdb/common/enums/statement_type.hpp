@@ -68,7 +68,8 @@ class ClientContext;
 struct StatementProperties {
 	StatementProperties()
 	    : requires_valid_transaction(true), allow_stream_result(false), bound_all_parameters(true),
-	      return_type(StatementReturnType::QUERY_RESULT), parameter_count(0), always_require_rebind(false) {
+	      return_type(StatementReturnType::QUERY_RESULT), parameter_count(0), always_require_rebind(false),
+	      append_only(false) {
 	}
 
 	struct CatalogIdentity {
@@ -101,6 +102,8 @@ struct StatementProperties {
 	idx_t parameter_count;
 	//! Whether or not the statement ALWAYS requires a rebind
 	bool always_require_rebind;
+	//! Whether or not the statement only modifies the database by appending to tables without indexes
+	bool append_only;
 
 	bool IsReadOnly() {
 		return modified_databases.empty();
@@ -12,6 +12,6 @@
 
 namespace duckdb {
 
-enum class ThreadPinMode : uint8_t { OFF = 0, ON = 1, AUTO = 2 };
+enum class ThreadPinMode : uint8_t { OFF = 0, ON = 1, AUTO = 2, NUMA = 3 };
 
 } // namespace duckdb
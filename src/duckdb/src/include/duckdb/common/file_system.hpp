@@ -55,6 +55,13 @@ enum class FileType {
 	FILE_TYPE_INVALID,
 };
 
+//! A positional read of nr_bytes at location into buffer, that is part of a batch of reads
+struct FileIORequest {
+	data_ptr_t buffer;
+	idx_t nr_bytes;
+	idx_t location;
+};
+
 struct FileHandle {
 public:
 	DUCKDB_API FileHandle(FileSystem &file_system, string path, FileOpenFlags flags);
@@ -69,6 +76,9 @@ public:
 	// File offset will not be changed.
 	DUCKDB_API void Read(void *buffer, idx_t nr_bytes, idx_t location);
 	DUCKDB_API void Write(QueryContext context, void *buffer, idx_t nr_bytes, idx_t location);
+	// Read all requests, each exactly [nr_bytes] at [location].
+	// File offset will not be changed.
+	DUCKDB_API void ReadBatch(vector<FileIORequest> &requests);
 	DUCKDB_API void Seek(idx_t location);
 	DUCKDB_API void Reset();
 	DUCKDB_API idx_t SeekPosition();
@@ -142,6 +152,11 @@ public:
 	DUCKDB_API virtual int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes);
 	//! Write nr_bytes from the buffer into the file, moving the file pointer forward by nr_bytes.
 	DUCKDB_API virtual int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes);
+	//! Read a batch of positional reads, failing if any of them could not be read completely. The default
+	//! implementation reads the requests one after the other.
+	DUCKDB_API virtual void ReadBatch(FileHandle &handle, vector<FileIORequest> &requests);
+	//! Whether ReadBatch keeps the reads of a batch in flight at the same time, rather than reading them one by one
+	DUCKDB_API virtual bool SupportsConcurrentBatchRead(FileHandle &handle);
 	//! Excise a range of the file. The OS can drop pages from the page-cache, and the file-system is free to deallocate
 	//! this range (sparse file support). Reads to the range will succeed but will return undefined data.
 	DUCKDB_API virtual bool Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes);
@@ -0,0 +1,44 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/io_uring.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+struct FileIORequest;
+
+//! Failures that can be injected into io_uring reads for testing (see the debug_io_uring_failure setting)
+enum class IOUringFailure : uint8_t {
+	NONE,
+	//! io_uring_enter fails before any read was submitted
+	SUBMIT,
+	//! io_uring_enter fails after the reads were submitted, while they are in flight
+	WAIT
+};
+
+//! IOUring submits batches of positional reads through the Linux io_uring interface, so that the reads of a batch
+//! are in flight at the same time and only cost a few system calls. Every thread uses its own ring.
+//! io_uring is not available on other platforms, on kernels older than 5.1, or when it is blocked (e.g. by seccomp);
+//! in that case IsAvailable returns false and the caller should fall back to regular reads.
+class IOUring {
+public:
+	//! Whether io_uring can be used in this process
+	static bool IsAvailable();
+	//! Reads all requests from the file descriptor. For every request, results contains the amount of bytes that were
+	//! read (which can be less than requested) or the negated errno if the read failed.
+	//! Returns false without reading anything if io_uring cannot be used. If the kernel fails the batch after reads
+	//! were submitted, all submitted reads are waited for before an IOException is thrown.
+	static bool ReadBatch(int fd, vector<FileIORequest> &requests, vector<int64_t> &results);
+
+	//! Inject a failure into all following io_uring reads of this process, for testing
+	static void SetFailureInjection(IOUringFailure failure);
+	static IOUringFailure GetFailureInjection();
+};
+
+} // namespace duckdb
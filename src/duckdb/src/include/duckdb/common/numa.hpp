@@ -0,0 +1,25 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/numa.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/file_system.hpp"
+
+namespace duckdb {
+
+class NUMA {
+public:
+	//! Returns the CPUs of every NUMA node that has CPUs, ordered by node id
+	//! Returns an empty list if the topology could not be determined (e.g. on systems other than Linux)
+	static vector<vector<idx_t>> GetNodeCPUs(FileSystem &fs);
+	//! Parses a Linux CPU list (e.g. "0-3,8,10-11") into the individual CPU ids
+	static vector<idx_t> ParseCPUList(const string &cpu_list);
+};
+
+} // namespace duckdb
@@ -38,6 +38,14 @@ public:
 		return GetFileSystem().Write(handle, buffer, nr_bytes);
 	}
 
+	void ReadBatch(FileHandle &handle, vector<FileIORequest> &requests) override {
+		GetFileSystem().ReadBatch(handle, requests);
+	}
+
+	bool SupportsConcurrentBatchRead(FileHandle &handle) override {
+		return GetFileSystem().SupportsConcurrentBatchRead(handle);
+	}
+
 	int64_t GetFileSize(FileHandle &handle) override {
 		return GetFileSystem().GetFileSize(handle);
 	}
@@ -69,6 +69,8 @@ public:
 	OperatorPartitionData GetPartitionData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
 	                                       LocalSourceState &lstate, const OperatorPartitionInfo &partition_info) const;
 	ProgressData GetProgress(ClientContext &context, GlobalSourceState &gstate) const;
+	//! The number of rows in the partitions that GetData emits (only the last partition can be smaller)
+	idx_t GetPartitionSize(GlobalSourceState &gstate) const;
 };
 
 } // namespace duckdb
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "duckdb/common/radix_partitioning.hpp"
+#include "duckdb/common/string_map_set.hpp"
 #include "duckdb/common/types/column/column_data_consumer.hpp"
 #include "duckdb/common/types/column/partitioned_column_data.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
@@ -62,6 +64,8 @@ public:
 	//! only compare salts with the ht entries if the capacity is larger than 8192 so
 	//! that it does not fit into the CPU cache
 	static constexpr const idx_t USE_SALT_THRESHOLD = 8192;
+	//! The assumed size of the last-level cache if it cannot be determined
+	static constexpr const idx_t DEFAULT_LAST_LEVEL_CACHE_SIZE = 32ULL * 1024ULL * 1024ULL;
 
 	//! Scan structure that can be used to resume scans, as a single probe can
 	//! return 1024*N values (where N is the size of the HT). This is
@@ -212,6 +216,22 @@ public:
 	bool NullValuesAreEqual(idx_t col_idx) const {
 		return null_values_are_equal[col_idx];
 	}
+	//! Get the type of a key or payload column (the layout type differs for dictionary-encoded payload columns)
+	const LogicalType &GetColumnType(idx_t col_idx) const {
+		if (col_idx < condition_types.size()) {
+			return condition_types[col_idx];
+		}
+		return build_types[col_idx - condition_types.size()];
+	}
+	//! Whether any of the payload columns are dictionary-encoded
+	bool HasPayloadDictionaries() const {
+		return !payload_dictionaries.empty();
+	}
+	//! Use the payload dictionaries of another HT, must be called before any data is added to this HT
+	void SharePayloadDictionaries(const JoinHashTable &other);
+	//! Gather a key or payload column from the given rows into the result, decoding dictionary-encoded columns
+	void GatherColumn(Vector &row_locations, const SelectionVector &scan_sel, idx_t scan_count, column_t column_id,
+	                  Vector &result, const SelectionVector &target_sel) const;
 
 	ClientContext &context;
 	const PhysicalOperator &op;
@@ -251,6 +271,9 @@ public:
 
 	//! If there is more than one element in the chain, we need to scan the next elements of the chain
 	bool chains_longer_than_one;
+	//! Whether the HT exceeds the last-level cache, so probes prefetch the HT entries and rows of a whole vector
+	//! before following the pointers
+	bool prefetch_probes = false;
 
 	//! The capacity of the HT. Is the same as hash_map.GetSize() / sizeof(ht_entry_t)
 	idx_t capacity = DConstants::INVALID_INDEX;
@@ -334,6 +357,9 @@ public:
 	// External Join
 	//===--------------------------------------------------------------------===//
 	static constexpr const idx_t INITIAL_RADIX_BITS = 4;
+	//! If this fraction of the rows of a partition stays together at the maximum number of radix bits (e.g., because a
+	//! single key dominates the partition), repartitioning cannot split it up
+	static constexpr const double HEAVY_HITTER_THRESHOLD = 0.8;
 
 	struct ProbeSpillLocalAppendState {
 		ProbeSpillLocalAppendState() {
@@ -360,6 +386,8 @@ public:
 	public:
 		//! Prepare the next probe round
 		void PrepareNextProbe();
+		//! Repartition the probe data after the HT has been repartitioned with more radix bits
+		void Repartition();
 		//! Scans and consumes the ColumnDataCollection
 		unique_ptr<ColumnDataConsumer> consumer;
 
@@ -382,6 +410,74 @@ public:
 		unique_ptr<ColumnDataCollection> global_spill_collection;
 	};
 
+	//! PartitionKeyStatistics keeps track of the number of build-side rows, and the min/max of the first key (if it is
+	//! integral) per radix partition. The statistics are kept at the maximum number of radix bits, so they remain
+	//! valid when the HT is repartitioned. Used to discard probe rows that cannot find a match instead of spilling
+	//! them, and to find out whether repartitioning can split up a partition that does not fit in memory
+	struct PartitionKeyStatistics {
+	public:
+		static constexpr const idx_t RADIX_BITS = RadixPartitioning::MAX_RADIX_BITS;
+
+		PartitionKeyStatistics(const LogicalType &key_type, bool nulls_are_equal);
+
+	public:
+		//! Update the statistics with the build-side keys and their hashes
+		void Update(DataChunk &keys, Vector &hashes, const SelectionVector &sel, idx_t count);
+		//! Merge the statistics of another HT into these statistics
+		void Merge(const PartitionKeyStatistics &other);
+		//! Select the probe-side rows that can find a match on the build side, returns the number of such rows
+		idx_t SelectCanMatch(DataChunk &keys, Vector &hashes, const SelectionVector &sel, idx_t count,
+		                     SelectionVector &result) const;
+		//! Get the largest number of build-side rows that end up in a single partition if the partition with the given
+		//! index (at the given radix bits) is repartitioned with "new_radix_bits"
+		idx_t MaxRepartitionedCount(idx_t radix_bits, idx_t partition_idx, idx_t new_radix_bits) const;
+
+	private:
+		//! The physical type of the first key
+		PhysicalType key_type;
+		//! Whether NULL keys can find a match
+		bool nulls_are_equal;
+		//! Whether min/max of the first key are tracked (only if it is a signed or small unsigned integer)
+		bool has_min_max;
+		//! The number of build-side rows per partition
+		vector<idx_t> counts;
+		//! The min/max of the first key per partition
+		vector<int64_t> min;
+		vector<int64_t> max;
+	};
+
+	//! PayloadDictionary dictionary-encodes a VARCHAR payload column, so that the HT stores a 4-byte code per row
+	//! instead of the string. It is shared by the global HT and the thread-local HTs, so the codes are the same in all
+	//! of them. The strings are allocated through the buffer manager, so they count towards the memory limit
+	struct PayloadDictionary {
+	public:
+		//! The maximum number of strings in a thread-local cache, the cache is cleared when it is full
+		static constexpr const idx_t MAX_LOCAL_CACHE_ENTRIES = 4096;
+		//! The (approximate) size of an entry of a thread-local cache in bytes
+		static constexpr const idx_t LOCAL_CACHE_ENTRY_SIZE = 2 * sizeof(string_t) + sizeof(uint32_t);
+
+		explicit PayloadDictionary(Allocator &allocator);
+
+	public:
+		//! Encode the strings into codes, the thread-local cache is consulted before locking the dictionary
+		void Encode(Vector &input, idx_t count, Vector &result, string_map_t<uint32_t> &local_cache);
+		//! Decode the codes at the selected positions into strings that reference the dictionary (after the build)
+		void Decode(Vector &input, const SelectionVector &sel, idx_t count, Vector &result) const;
+		//! The (approximate) size of the dictionary in bytes
+		idx_t SizeInBytes() const;
+
+	private:
+		mutex lock;
+		//! Owns the strings of the dictionary, decoded vectors hold a reference to it
+		buffer_ptr<VectorStringBuffer> strings;
+		//! The strings of the dictionary, the index of a string is its code
+		vector<string_t> entries;
+		//! Map from string to code
+		string_map_t<uint32_t> codes;
+		//! The size of the strings and the entries in bytes
+		atomic<idx_t> size_in_bytes;
+	};
+
 	idx_t GetRadixBits() const {
 		return radix_bits;
 	}
@@ -412,6 +508,10 @@ public:
 	                   idx_t &max_partition_size, idx_t &max_partition_count) const;
 	//! Get the remaining size of the unbuilt partitions
 	idx_t GetRemainingSize() const;
+	//! Get the size of the payload dictionaries
+	idx_t GetPayloadDictionarySize() const;
+	//! Get the size of the thread-local caches of the payload dictionary codes
+	idx_t GetPayloadDictionaryCacheSize() const;
 	//! Sets number of radix bits according to the max ht size
 	void SetRepartitionRadixBits(const idx_t max_ht_size, const idx_t max_partition_size,
 	                             const idx_t max_partition_count);
@@ -428,6 +528,17 @@ public:
 	void Reset();
 	//! Build HT for the next partitioned probe round
 	bool PrepareExternalFinalize(const idx_t max_ht_size);
+	//! Collect the key statistics from the partitioned build side (if they were not collected while building)
+	void CollectKeyStatistics();
+	//! Repartition the unfinished partitions with more radix bits if that splits up the given partition, which does
+	//! not fit in memory. Returns true if the HT was repartitioned
+	bool RepartitionOversizedPartition(const idx_t partition_idx, const idx_t max_ht_size);
+	//! Split the build side of a partition that does not fit in memory into parts that do. The parts are built and
+	//! probed against all probe-side rows of the partition one at a time (only if probe rows without a match produce
+	//! no output, so a probe row may be probed more than once)
+	void SplitPartition(const idx_t partition_idx, const idx_t max_ht_size);
+	//! Move the next part of the split partition to the main data collection
+	void PrepareNextSplitPartitionPart();
 	//! Probe whatever we can, sink the rest into a thread-local HT
 	void ProbeAndSpill(ScanStructure &scan_structure, DataChunk &probe_keys, TupleDataChunkState &key_state,
 	                   ProbeState &probe_state, DataChunk &probe_chunk, ProbeSpill &probe_spill,
@@ -441,6 +552,15 @@ private:
 	ValidityMask current_partitions;
 	//! Bits set to 1 for completed partitions
 	ValidityMask completed_partitions;
+	//! Key statistics of the build side per partition (only collected while building if the join may go external)
+	unique_ptr<PartitionKeyStatistics> key_statistics;
+	//! The partition that was split into parts because a single key dominates it, and its remaining parts
+	idx_t split_partition_idx = DConstants::INVALID_INDEX;
+	vector<unique_ptr<TupleDataCollection>> split_partition_parts;
+	//! The dictionaries of the dictionary-encoded payload columns, indexed by column (empty if none are encoded)
+	vector<shared_ptr<PayloadDictionary>> payload_dictionaries;
+	//! Thread-local caches of the dictionary codes, so that this HT does not have to lock the shared dictionaries
+	vector<string_map_t<uint32_t>> payload_dictionary_caches;
 };
 
 } // namespace duckdb
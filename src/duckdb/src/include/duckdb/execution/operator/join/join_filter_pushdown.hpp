@@ -74,8 +74,11 @@ public:
 	                               JoinFilterGlobalState &gstate, const PhysicalComparisonJoin &op) const;
 
 private:
-	void PushInFilter(const JoinFilterPushdownFilter &info, JoinHashTable &ht, const PhysicalOperator &op,
+	//! Returns whether an IN filter was pushed
+	bool PushInFilter(const JoinFilterPushdownFilter &info, JoinHashTable &ht, const PhysicalOperator &op,
 	                  idx_t filter_idx, idx_t filter_col_idx) const;
+	void PushBloomFilter(const JoinFilterPushdownFilter &info, JoinHashTable &ht, const PhysicalOperator &op,
+	                     idx_t filter_idx, idx_t filter_col_idx) const;
 };
 
 } // namespace duckdb
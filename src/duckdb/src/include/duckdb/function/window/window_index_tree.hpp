@@ -18,9 +18,6 @@ class WindowIndexTreeLocalState : public WindowMergeSortTreeLocalState {
 public:
 	explicit WindowIndexTreeLocalState(WindowIndexTree &index_tree);
 
-	//! Process sorted leaf data
-	void BuildLeaves() override;
-
 	//! The index tree we are building
 	WindowIndexTree &index_tree;
 };
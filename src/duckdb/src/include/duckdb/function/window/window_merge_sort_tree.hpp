@@ -12,8 +12,10 @@
 #include "duckdb/planner/bound_result_modifier.hpp"
 
 #include "duckdb/function/window/window_aggregator.hpp"
-#include "duckdb/common/sort/sort.hpp"
+#include "duckdb/common/sorting/sort.hpp"
 #include "duckdb/common/sort/partition_state.hpp"
+#include "duckdb/execution/execution_context.hpp"
+#include "duckdb/parallel/thread_context.hpp"
 
 namespace duckdb {
 
@@ -27,17 +29,23 @@ public:
 	void SinkChunk(DataChunk &chunk, const idx_t row_idx, optional_ptr<SelectionVector> filter_sel, idx_t filtered);
 	//! Sort the data
 	void Sort();
-	//! Process sorted leaf data
-	virtual void BuildLeaves() = 0;
+	//! Process a chunk of sorted leaf data that starts at sorted position row_idx
+	virtual void BuildLeaves(DataChunk &sorted, const idx_t row_idx);
 
 	//! The index tree we are building
 	WindowMergeSortTree &window_tree;
+	//! Thread context for the sort
+	ThreadContext thread;
+	//! Execution context for the sort
+	ExecutionContext execution;
+	//! Interrupt state for the sort (never blocks)
+	InterruptState interrupt_state;
 	//! Thread-local sorting data
-	optional_ptr<LocalSortState> local_sort;
-	//! Buffer for the sort keys
+	optional_ptr<LocalSinkState> local_sink;
+	//! Buffer for the sort input
 	DataChunk sort_chunk;
-	//! Buffer for the payload data
-	DataChunk payload_chunk;
+	//! Buffer for the sorted output
+	DataChunk sorted_chunk;
 	//! Build stage
 	PartitionSortStage build_stage = PartitionSortStage::INIT;
 	//! Build task number
@@ -45,21 +53,24 @@ public:
 
 private:
 	void ExecuteSortTask();
+	//! Scan sorted partitions until the sort is exhausted
+	void ScanSorted();
 };
 
 class WindowMergeSortTree {
 public:
-	using GlobalSortStatePtr = unique_ptr<GlobalSortState>;
-	using LocalSortStatePtr = unique_ptr<LocalSortState>;
+	using LocalSinkStatePtr = unique_ptr<LocalSinkState>;
 
+	//! Sorts the row indices by the orders. If project_keys is set, the sorted output also contains the sort keys.
 	WindowMergeSortTree(ClientContext &context, const vector<BoundOrderByNode> &orders,
-	                    const vector<column_t> &sort_idx, const idx_t count, bool unique = false);
+	                    const vector<column_t> &sort_idx, const idx_t count, bool unique = false,
+	                    bool project_keys = false);
 	virtual ~WindowMergeSortTree() = default;
 
 	virtual unique_ptr<WindowAggregatorState> GetLocalState() = 0;
 
 	//! Make a local sort for a thread
-	optional_ptr<LocalSortState> AddLocalSort();
+	optional_ptr<LocalSinkState> AddLocalSort(ExecutionContext &execution);
 
 	//! Thread-safe post-sort cleanup
 	virtual void CleanupSort();
@@ -71,16 +82,22 @@ public:
 
 	//! The query context
 	ClientContext &context;
-	//! Thread memory limit
-	const idx_t memory_per_thread;
 	//! The column indices for sorting
 	const vector<column_t> sort_idx;
+	//! The types of the sort input: the sort columns, followed by the row indices
+	vector<LogicalType> sort_types;
+	//! The types of the sorted output: the row indices, optionally followed by the sort keys
+	vector<LogicalType> sorted_types;
+	//! The sort of the row indices
+	unique_ptr<duckdb::Sort> sort;
+	//! The global sort state
+	unique_ptr<GlobalSinkState> global_sink;
 	//! The sorted data
-	GlobalSortStatePtr global_sort;
+	unique_ptr<GlobalSourceState> global_source;
 	//! Finalize guard
 	mutex lock;
 	//! Local sort set
-	vector<LocalSortStatePtr> local_sorts;
+	vector<LocalSinkStatePtr> local_sorts;
 	//! Finalize stage
 	atomic<PartitionSortStage> build_stage;
 	//! Tasks launched
@@ -89,8 +106,10 @@ public:
 	idx_t tasks_assigned = 0;
 	//! Tasks landed
 	atomic<idx_t> tasks_completed;
-	//! The block starts (the scanner doesn't know this) plus the total count
-	vector<idx_t> block_starts;
+	//! The number of rows sunk into the sort
+	atomic<idx_t> sort_count;
+	//! The number of rows in each sorted partition
+	idx_t partition_size = 0;
 
 	// Merge sort trees for various sizes
 	// Smaller is probably not worth the effort.
@@ -100,7 +119,7 @@ public:
 	unique_ptr<MergeSortTree64> mst64;
 
 protected:
-	//! Find the starts of all the blocks
+	//! Allocate the leaves for the sorted rows
 	//! Returns the total number of rows
 	virtual idx_t MeasurePayloadBlocks();
 };
@@ -17,7 +17,7 @@ class WindowTokenTree : public WindowMergeSortTree {
 public:
 	WindowTokenTree(ClientContext &context, const vector<BoundOrderByNode> &orders, const vector<column_t> &sort_idx,
 	                const idx_t count, bool unique = false)
-	    : WindowMergeSortTree(context, orders, sort_idx, count, unique) {
+	    : WindowMergeSortTree(context, orders, sort_idx, count, unique, !unique) {
 	}
 	WindowTokenTree(ClientContext &context, const BoundOrderModifier &order_bys, const vector<column_t> &sort_idx,
 	                const idx_t count, bool unique = false)
@@ -37,6 +37,9 @@ public:
 
 	//! Peer boundaries.
 	vector<uint8_t> deltas;
+	//! The sort keys of the first and last rows of each sorted partition
+	vector<vector<Value>> partition_firsts;
+	vector<vector<Value>> partition_lasts;
 
 protected:
 	//! Find the starts of all the blocks
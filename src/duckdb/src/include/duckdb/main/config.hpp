@@ -197,6 +197,8 @@ struct DBConfigOptions {
 	bool force_checkpoint = false;
 	//! Run a checkpoint on successful shutdown and delete the WAL, to leave only a single database file behind
 	bool checkpoint_on_shutdown = true;
+	//! Run automatic checkpoints on a background thread, commits that cross the threshold write to the WAL instead
+	bool background_checkpoint = false;
 	//! Serialize the metadata on checkpoint with compatibility for a given DuckDB version.
 	SerializationCompatibility serialization_compatibility = SerializationCompatibility::Default();
 	//! Debug flag that decides when a checkpoing should be aborted. Only used for testing purposes.
@@ -296,6 +298,8 @@ struct DBConfigOptions {
 	DebugVectorVerification debug_verify_vector = DebugVectorVerification::NONE;
 	//! The maximum amount of vacuum tasks to schedule during a checkpoint
 	idx_t max_vacuum_tasks = 100;
+	//! The number of background threads that read ahead the blocks of table scans over local files (0 = disabled)
+	idx_t read_ahead_threads = 0;
 	//! Paths that are explicitly allowed, even if enable_external_access is false
 	unordered_set<string> allowed_paths;
 	//! Directories that are explicitly allowed, even if enable_external_access is false
@@ -312,6 +316,8 @@ struct DBConfigOptions {
 #else
 	bool scheduler_process_partial = false;
 #endif
+	//! Share the threads between running queries in proportion to their weight
+	bool scheduler_fair_queuing = false;
 	//! Whether to pin threads to cores (linux only, default AUTOMATIC: on when there are more than 64 cores)
 	ThreadPinMode pin_threads = ThreadPinMode::AUTO;
 	//! Enable the Parquet reader to identify a Variant group structurally
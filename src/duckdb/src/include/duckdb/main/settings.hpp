@@ -273,6 +273,18 @@ struct AutoloadKnownExtensionsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BackgroundCheckpointSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "background_checkpoint";
+	static constexpr const char *Description =
+	    "Whether automatic checkpoints run on a background thread instead of in the commit that crosses the "
+	    "checkpoint threshold";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct CatalogErrorMaxSchemasSetting {
 	using RETURN_TYPE = idx_t;
 	static constexpr const char *Name = "catalog_error_max_schemas";
@@ -368,6 +380,17 @@ struct DebugForceNoCrossProductSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct DebugIoUringFailureSetting {
+	using RETURN_TYPE = string;
+	static constexpr const char *Name = "debug_io_uring_failure";
+	static constexpr const char *Description =
+	    "DEBUG SETTING: make io_uring reads of this process fail before (submit) or after (wait) submitting them";
+	static constexpr const char *InputType = "VARCHAR";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DebugSkipCheckpointOnCommitSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "debug_skip_checkpoint_on_commit";
@@ -451,6 +474,18 @@ struct DefaultSecretStorageSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct DictionaryEncodeJoinPayloadsSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "dictionary_encode_join_payloads";
+	static constexpr const char *Description =
+	    "Dictionary-encode VARCHAR payload columns in hash join hash tables, so that build sides with repeated strings "
+	    "use less memory";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DisableDatabaseInvalidationSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "disable_database_invalidation";
@@ -1074,7 +1109,8 @@ struct PinThreadsSetting {
 	using RETURN_TYPE = ThreadPinMode;
 	static constexpr const char *Name = "pin_threads";
 	static constexpr const char *Description =
-	    "Whether to pin threads to cores (Linux only, default AUTO: on when there are more than 64 cores)";
+	    "Whether to pin threads to cores (Linux only, default AUTO: on when there are more than 64 cores). NUMA "
+	    "spreads the threads over the NUMA nodes and pins each thread to the cores of its node";
 	static constexpr const char *InputType = "VARCHAR";
 	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
 	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
@@ -1188,6 +1224,18 @@ struct ProgressBarTimeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct ReadAheadThreadsSetting {
+	using RETURN_TYPE = idx_t;
+	static constexpr const char *Name = "read_ahead_threads";
+	static constexpr const char *Description =
+	    "The number of background threads that load the next row group of table scans over local database files. "
+	    "Set to 0 to disable read-ahead.";
+	static constexpr const char *InputType = "UBIGINT";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ScalarSubqueryErrorOnMultipleRowsSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "scalar_subquery_error_on_multiple_rows";
@@ -1199,6 +1247,19 @@ struct ScalarSubqueryErrorOnMultipleRowsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct SchedulerFairQueuingSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "scheduler_fair_queuing";
+	static constexpr const char *Description =
+	    "Share the threads between running queries in proportion to their scheduler_weight, instead of in the order "
+	    "in which their tasks were scheduled. Tasks are processed partially, so that long-running queries give up "
+	    "their threads regularly";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct SchedulerProcessPartialSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "scheduler_process_partial";
@@ -1210,6 +1271,19 @@ struct SchedulerProcessPartialSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct SchedulerWeightSetting {
+	using RETURN_TYPE = idx_t;
+	static constexpr const char *Name = "scheduler_weight";
+	static constexpr const char *Description =
+	    "The share of the threads that queries of this connection get relative to other queries, when "
+	    "scheduler_fair_queuing is enabled";
+	static constexpr const char *InputType = "UBIGINT";
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static bool OnLocalSet(ClientContext &context, const Value &input);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct SchemaSetting {
 	using RETURN_TYPE = string;
 	static constexpr const char *Name = "schema";
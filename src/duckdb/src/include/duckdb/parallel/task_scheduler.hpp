@@ -17,7 +17,10 @@
 namespace duckdb {
 
 struct ConcurrentQueue;
+struct FairQueue;
+struct FairQueueEntry;
 struct QueueProducerToken;
+struct WorkerQueue;
 class ClientContext;
 class DatabaseInstance;
 class TaskScheduler;
@@ -31,13 +34,22 @@ struct ProducerToken {
 	TaskScheduler &scheduler;
 	unique_ptr<QueueProducerToken> token;
 	mutex producer_lock;
+	//! The fair queuing state of this producer, shared with the fair queue of the scheduler
+	//! The token does not unregister itself from the scheduler: the fair queue drops entries of destroyed tokens
+	shared_ptr<FairQueueEntry> fair_queue_entry;
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
 class TaskScheduler {
+	friend struct ProducerToken;
+
 	// timeout for semaphore wait, default 5ms
 	constexpr static int64_t TASK_TIMEOUT_USECS = 5000;
 
+public:
+	//! The maximum weight of a producer
+	static constexpr const idx_t MAX_PRODUCER_WEIGHT = 1000;
+
 public:
 	explicit TaskScheduler(DatabaseInstance &db);
 	~TaskScheduler();
@@ -45,11 +57,13 @@ public:
 	DUCKDB_API static TaskScheduler &GetScheduler(ClientContext &context);
 	DUCKDB_API static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
-	unique_ptr<ProducerToken> CreateProducer();
+	//! Create a producer, the weight determines its share of the threads when fair queuing is enabled
+	unique_ptr<ProducerToken> CreateProducer(idx_t weight = 1);
 	//! Schedule a task to be executed by the task scheduler
 	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
 	void ScheduleTasks(ProducerToken &producer, vector<shared_ptr<Task>> &tasks);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
+	//! When called from a worker thread, tasks of the producer in the worker's local queue are considered as well
 	bool GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task);
 	//! Run tasks forever until "marker" is set to false, "marker" must remain valid until the thread is joined
 	void ExecuteForever(atomic<bool> *marker);
@@ -91,11 +105,37 @@ public:
 
 private:
 	void RelaunchThreadsInternal(int32_t n);
+	//! Returns the local queue of the calling thread, if it is one of the worker threads of this scheduler
+	optional_ptr<WorkerQueue> GetLocalQueue();
+	//! Steal a task from the local queue of another worker thread
+	bool StealTask(idx_t worker_idx, shared_ptr<Task> &task);
+	//! Fetch a task from the global queue, taking the producer weights into account if fair queuing is enabled
+	bool DequeueTask(shared_ptr<Task> &task);
+	//! Fetch a task from the producer that received the smallest share of the threads relative to its weight
+	bool DequeueTaskFair(shared_ptr<Task> &task);
+	//! DequeueTaskFair with the lock of the fair queue held, returns the weight of the producer and the number of
+	//! producers in the ready set
+	bool DequeueTaskFairInternal(shared_ptr<Task> &task, idx_t &weight, idx_t &ready_count);
+	//! Count a task that was taken from the global queue outside of the fair queue against the share of its producer
+	void ChargeProducer(ProducerToken &token);
+	//! Add tasks to the global queue, and add the producer to the fair queue if fair queuing is enabled
+	void EnqueueTask(ProducerToken &token, shared_ptr<Task> task);
+	void EnqueueTasks(ProducerToken &token, vector<shared_ptr<Task>> &tasks);
+	//! Add the producer to the fair queue if it is not in there yet
+	void MarkProducerReady(ProducerToken &token);
 
 private:
 	DatabaseInstance &db;
-	//! The task queue
+	//! The global task queue
 	unique_ptr<ConcurrentQueue> queue;
+	//! The local task queues of the background threads, indexed by worker. Tasks scheduled from a worker thread are
+	//! pushed to its local queue, idle workers steal from the local queues of other workers.
+	//! Only tasks in the global queue are signalled on the semaphore one by one, a worker wakes up an idle worker
+	//! when its local queue has a backlog.
+	//! Only modified while no background threads are running.
+	vector<unique_ptr<WorkerQueue>> worker_queues;
+	//! The producers that have tasks in the global queue, ordered by their virtual time (used for fair queuing)
+	unique_ptr<FairQueue> fair_queue;
 	//! Lock for modifying the thread count
 	mutex thread_lock;
 	//! The active background threads of the task scheduler
@@ -110,6 +150,8 @@ private:
 	atomic<int32_t> requested_thread_count;
 	//! The amount of threads currently running
 	atomic<int32_t> current_thread_count;
+	//! The amount of background threads waiting on the semaphore for a task
+	atomic<idx_t> idle_worker_count;
 };
 
 } // namespace duckdb
@@ -52,6 +52,10 @@ public:
 	const duckdb::CompressionType &CompressionType() const;
 	void SetCompressionType(duckdb::CompressionType compression_type);
 
+	//! bloom_filter: whether a Bloom filter is built for every row group of this column (stored as a column tag)
+	bool HasBloomFilter() const;
+	void SetBloomFilter(bool bloom_filter);
+
 	//! storage_oid
 	const storage_t &StorageOid() const;
 	void SetStorageOid(storage_t storage_oid);
@@ -85,7 +85,8 @@ enum class AlterTableType : uint8_t {
 	SET_SORTED_BY = 13,
 	ADD_FIELD = 14,
 	REMOVE_FIELD = 15,
-	RENAME_FIELD = 16
+	RENAME_FIELD = 16,
+	SET_BLOOM_FILTER = 17
 };
 
 struct AlterTableInfo : public AlterInfo {
@@ -484,4 +485,26 @@ private:
 	SetSortedByInfo();
 };
 
+//===--------------------------------------------------------------------===//
+// SetBloomFilterInfo
+//===--------------------------------------------------------------------===//
+struct SetBloomFilterInfo : public AlterTableInfo {
+	SetBloomFilterInfo(AlterEntryData data, string column_name, bool bloom_filter);
+	~SetBloomFilterInfo() override;
+
+	//! The column name to alter
+	string column_name;
+	//! Whether a Bloom filter is declared (true) or dropped (false) for the column
+	bool bloom_filter;
+
+public:
+	unique_ptr<AlterInfo> Copy() const override;
+	string ToString() const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<AlterTableInfo> Deserialize(Deserializer &deserializer);
+
+private:
+	SetBloomFilterInfo();
+};
+
 } // namespace duckdb
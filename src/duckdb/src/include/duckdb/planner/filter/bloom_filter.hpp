@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+struct BloomFilterState;
+
+//! A split block Bloom filter over value hashes. Every hash sets one bit in each of the 8 words of a single 256-bit
+//! block, so both insertion and lookup touch a single cache line.
+class BlockedBloomFilter {
+public:
+	//! Bits per expected key, gives a false positive rate of roughly 0.1%
+	static constexpr idx_t DEFAULT_BITS_PER_KEY = 16;
+
+public:
+	explicit BlockedBloomFilter(idx_t expected_count, idx_t bits_per_key = DEFAULT_BITS_PER_KEY);
+
+	void Insert(hash_t hash);
+	bool Lookup(hash_t hash) const;
+	idx_t SizeInBytes() const;
+
+	void Serialize(Serializer &serializer) const;
+	static shared_ptr<BlockedBloomFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	static constexpr idx_t WORDS_PER_BLOCK = 8;
+
+	//! The block and the per-word bit masks for a hash
+	inline idx_t BlockIndex(hash_t hash) const;
+	static inline uint32_t BitMask(hash_t hash, idx_t word_idx);
+
+	vector<uint32_t> words;
+	idx_t block_mask;
+};
+
+//! Filters the rows whose hash is not contained in a Bloom filter built over the build-side keys of a hash join.
+//! The filter can produce false positives, so it is only used to skip rows early, never for correctness.
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+	//! Number of probed rows after which the filter checks whether it is selective enough to keep evaluating it
+	static constexpr const idx_t SELECTIVITY_CHECK_COUNT = 16 * STANDARD_VECTOR_SIZE;
+	//! The filter is disabled for the scan when more than this fraction of the probed rows pass it
+	static constexpr const double MAX_PASS_RATIO = 0.9;
+	//! Hash joins with more build-side rows than this do not build a Bloom filter
+	static constexpr const idx_t MAX_BUILD_COUNT = idx_t(1) << 24;
+
+public:
+	BloomFilter();
+	explicit BloomFilter(shared_ptr<BlockedBloomFilter> filter);
+
+	//! The shared Bloom filter, no rows are filtered when it is not set
+	shared_ptr<BlockedBloomFilter> filter;
+
+public:
+	//! Removes the rows from sel that are not contained in the filter, returns the new approved tuple count
+	idx_t Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t scan_count,
+	             idx_t approved_tuple_count, BloomFilterState &state) const;
+	//! Whether the value may be contained in the filter
+	bool FilterValue(const Value &value) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) const override;
+	string ToString(const string &column_name) const override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+};
+
+} // namespace duckdb
@@ -45,6 +45,14 @@ public:
 	vector<unique_ptr<TableFilterState>> child_states;
 };
 
+struct BloomFilterState : public TableFilterState {
+public:
+	idx_t probed_count = 0;
+	idx_t passed_count = 0;
+	//! Set when the filter turned out not to be selective for this scan
+	bool disabled = false;
+};
+
 struct ExpressionFilterState : public TableFilterState {
 public:
 	ExpressionFilterState(ClientContext &context, const Expression &expression);
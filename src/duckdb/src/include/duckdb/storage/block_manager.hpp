@@ -24,6 +24,17 @@ class ClientContext;
 class DatabaseInstance;
 class MetadataManager;
 
+//! A range of consecutive blocks that is read into a buffer, as part of a batch of reads
+struct BlockReadRequest {
+	BlockReadRequest(FileBuffer &buffer, block_id_t start_block, idx_t block_count)
+	    : buffer(buffer), start_block(start_block), block_count(block_count) {
+	}
+
+	reference<FileBuffer> buffer;
+	block_id_t start_block;
+	idx_t block_count;
+};
+
 //! BlockManager is an abstract representation to manage blocks on DuckDB. When writing or reading blocks, the
 //! BlockManager creates and accesses blocks. The concrete types implement specific block storage strategies.
 class BlockManager {
@@ -61,6 +72,12 @@ public:
 	virtual void Read(Block &block) = 0;
 	//! Read the content of the block from disk
 	virtual void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) = 0;
+	//! Read multiple ranges of blocks. The default implementation reads the ranges one after the other.
+	virtual void ReadBlocksBatch(vector<BlockReadRequest> &requests);
+	//! Whether ReadBlocksBatch keeps the reads of all ranges in flight at the same time
+	virtual bool SupportsConcurrentBlockReads() {
+		return false;
+	}
 	//! Writes the block to disk.
 	virtual void Write(FileBuffer &block, block_id_t block_id) = 0;
 	virtual void Write(QueryContext context, FileBuffer &block, block_id_t block_id);
@@ -81,6 +98,9 @@ public:
 	}
 	//! Whether or not the attached database is in-memory
 	virtual bool InMemory() = 0;
+	//! Starts loading the given blocks into the buffer pool in the background, if supported by the block manager
+	virtual void ReadAhead(vector<shared_ptr<BlockHandle>> &handles) {
+	}
 
 	//! Sync changes made to the block manager
 	virtual void FileSync() = 0;
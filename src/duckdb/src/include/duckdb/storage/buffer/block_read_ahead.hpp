@@ -0,0 +1,55 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/buffer/block_read_ahead.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
+
+#include <condition_variable>
+
+namespace duckdb {
+class BlockHandle;
+class BufferManager;
+
+//! BlockReadAhead loads blocks into the buffer pool on a small set of background I/O threads, so that scans over
+//! local files do not wait on a synchronous read for every block. Loading is best-effort: requests that do not fit
+//! in the memory budget are dropped, and blocks that fail to load are loaded again when they are pinned.
+class BlockReadAhead {
+public:
+	BlockReadAhead(BufferManager &buffer_manager, idx_t thread_count);
+	~BlockReadAhead();
+
+public:
+	//! Schedules the blocks to be loaded in the background. Returns false (and drops the request) if the blocks
+	//! that are already scheduled plus the new ones exceed the memory budget.
+	bool Schedule(vector<shared_ptr<BlockHandle>> handles, idx_t memory_budget);
+
+private:
+	struct ReadAheadRequest {
+		vector<shared_ptr<BlockHandle>> handles;
+		idx_t size;
+	};
+
+	void WorkerLoop();
+
+private:
+	BufferManager &buffer_manager;
+	mutex lock;
+	std::condition_variable cv;
+	//! The scheduled requests that have not been picked up by a thread yet
+	deque<ReadAheadRequest> requests;
+	//! The total size of the scheduled and in-flight requests
+	idx_t scheduled_size = 0;
+	bool shutdown = false;
+	vector<thread> threads;
+};
+
+} // namespace duckdb
@@ -20,6 +20,7 @@
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/storage/compression/range_filter.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 
 namespace duckdb {
@@ -50,6 +51,24 @@ public:
 		                                     exceptions, exceptions_positions, frame_of_reference, bit_width);
 	}
 
+	//! Get the range of the values of the loaded vector without decoding it
+	void GetValueRange(T &min, T &max) const {
+		// the decoded values increase with the encoded integers, which are at most 'bit_width' bits above the FOR
+		const auto max_offset = bit_width >= sizeof(uint64_t) * 8 ? NumericLimits<uint64_t>::Maximum()
+		                                                          : (static_cast<uint64_t>(1) << bit_width) - 1;
+		const auto headroom = static_cast<uint64_t>(NumericLimits<int64_t>::Maximum()) - frame_of_reference;
+		const auto min_encoded = static_cast<int64_t>(frame_of_reference);
+		const auto max_encoded = max_offset >= headroom ? NumericLimits<int64_t>::Maximum()
+		                                                : static_cast<int64_t>(frame_of_reference + max_offset);
+		const alp::AlpEncodingIndices encoding_indices = {v_exponent, v_factor};
+		min = alp::AlpCompression<T, true>::DecodeValue(min_encoded, encoding_indices);
+		max = alp::AlpCompression<T, true>::DecodeValue(max_encoded, encoding_indices);
+		// the exceptions are stored as-is
+		for (idx_t i = 0; i < exceptions_count; i++) {
+			NumericStats::UpdateValue<T>(exceptions[i], min, max);
+		}
+	}
+
 public:
 	idx_t index;
 	T decoded_values[AlpConstants::ALP_VECTOR_SIZE];
@@ -87,6 +106,9 @@ public:
 	ColumnSegment &segment;
 	idx_t count;
 
+	//! Used to skip the vectors that cannot pass a filter
+	unique_ptr<CompressedRangeFilter> range_filter;
+
 	idx_t LeftInVector() const {
 		return AlpConstants::ALP_VECTOR_SIZE - (total_value_count % AlpConstants::ALP_VECTOR_SIZE);
 	}
@@ -240,4 +262,55 @@ void AlpScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, V
 	AlpScanPartial<T>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+void AlpFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+               SelectionVector &sel, idx_t &sel_count, const TableFilter &filter, TableFilterState &filter_state) {
+	auto &scan_state = state.scan_state->Cast<AlpScanState<T>>();
+	if (!CompressedRangeFilter::Supports<T>(result.GetType(), filter)) {
+		// fallback: scan + filter
+		AlpScan<T>(segment, state, vector_count, result);
+		UnifiedVectorFormat vdata;
+		result.ToUnifiedFormat(vector_count, vdata);
+		ColumnSegment::FilterSelection(sel, result, vdata, filter, filter_state, vector_count, sel_count);
+		return;
+	}
+	if (!scan_state.range_filter) {
+		scan_state.range_filter = make_uniq<CompressedRangeFilter>(result.GetType());
+	}
+	CompressedRangeFilter &range_filter = *scan_state.range_filter;
+	range_filter.Reset();
+
+	auto result_data = FlatVector::GetData<T>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+
+	idx_t scanned = 0;
+	while (scanned < vector_count) {
+		const auto to_scan = MinValue(vector_count - scanned, scan_state.LeftInVector());
+		const auto alp_vector_size =
+		    MinValue<idx_t>(AlpConstants::ALP_VECTOR_SIZE, scan_state.count - scan_state.total_value_count);
+		if (!scan_state.VectorFinished() || to_scan != alp_vector_size) {
+			// only part of the ALP vector is scanned, which requires decoding it
+			range_filter.AddRange(scanned, scanned + to_scan);
+			scan_state.template ScanVector<T>(result_data + scanned, to_scan);
+			scanned += to_scan;
+			continue;
+		}
+		// load the metadata of the ALP vector, and only decode it if values in its range can pass the filter
+		scan_state.template LoadVector<true>(nullptr);
+		T min;
+		T max;
+		scan_state.vector_state.GetValueRange(min, max);
+		if (range_filter.CheckRange<T>(filter, scanned, scanned + to_scan, min, max) !=
+		    FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			scan_state.vector_state.template LoadValues<false>(result_data + scanned, to_scan);
+		}
+		scan_state.total_value_count += to_scan;
+		scanned += to_scan;
+	}
+	range_filter.Apply(result, vector_count, sel, sel_count, filter, filter_state);
+}
+
 } // namespace duckdb
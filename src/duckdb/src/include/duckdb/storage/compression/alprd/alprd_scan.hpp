@@ -21,6 +21,7 @@
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/storage/compression/range_filter.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 
 namespace duckdb {
@@ -54,6 +55,48 @@ public:
 		                                       right_bit_width);
 	}
 
+	//! Get the range of the values of the loaded vector from the left parts that can occur in it, without decoding it
+	//! Returns false if the range is unknown
+	bool GetValueRange(T &min, T &max) const {
+		uint16_t min_left = NumericLimits<uint16_t>::Maximum();
+		uint16_t max_left = NumericLimits<uint16_t>::Minimum();
+		for (idx_t i = 0; i < actual_dictionary_size; i++) {
+			NumericStats::UpdateValue<uint16_t>(left_parts_dict[i], min_left, max_left);
+		}
+		for (idx_t i = 0; i < exceptions_count; i++) {
+			NumericStats::UpdateValue<uint16_t>(exceptions[i], min_left, max_left);
+		}
+		if (min_left > max_left) {
+			return false;
+		}
+		// the bit patterns of the values lie between the smallest left part with all-zero right parts and the largest
+		// left part with all-one right parts
+		const auto right_mask = static_cast<EXACT_TYPE>((static_cast<EXACT_TYPE>(1) << right_bit_width) - 1);
+		const auto low_bits = static_cast<EXACT_TYPE>(static_cast<EXACT_TYPE>(min_left) << right_bit_width);
+		const auto high_bits =
+		    static_cast<EXACT_TYPE>((static_cast<EXACT_TYPE>(max_left) << right_bit_width) | right_mask);
+		T low;
+		T high;
+		memcpy(&low, &low_bits, sizeof(T));
+		memcpy(&high, &high_bits, sizeof(T));
+
+		const auto sign_bit = static_cast<EXACT_TYPE>(static_cast<EXACT_TYPE>(1) << (sizeof(EXACT_TYPE) * 8 - 1));
+		if ((high_bits & sign_bit) == 0) {
+			// all values are positive: they increase with their bit pattern (NaN is the largest value)
+			min = low;
+			max = high;
+			return true;
+		}
+		if ((low_bits & sign_bit) != 0 && !Value::IsNan(high)) {
+			// all values are negative: they decrease with their bit pattern
+			min = high;
+			max = low;
+			return true;
+		}
+		// the values have mixed signs or can be negative NaNs
+		return false;
+	}
+
 public:
 	idx_t index;
 	uint8_t left_encoded[AlpRDConstants::ALP_VECTOR_SIZE * 8];
@@ -65,6 +108,7 @@ public:
 	uint8_t right_bit_width;
 	uint8_t left_bit_width;
 	uint16_t left_parts_dict[AlpRDConstants::MAX_DICTIONARY_SIZE];
+	uint8_t actual_dictionary_size;
 };
 
 template <class T>
@@ -90,6 +134,7 @@ public:
 		uint8_t actual_dictionary_size =
 		    Load<uint8_t>(segment_data + AlpRDConstants::METADATA_POINTER_SIZE + AlpRDConstants::RIGHT_BIT_WIDTH_SIZE +
 		                  AlpRDConstants::LEFT_BIT_WIDTH_SIZE);
+		vector_state.actual_dictionary_size = actual_dictionary_size;
 		uint8_t actual_dictionary_size_bytes = actual_dictionary_size * AlpRDConstants::DICTIONARY_ELEMENT_SIZE;
 
 		// Load the left parts dictionary which is after the segment header and is of a fixed size
@@ -106,6 +151,9 @@ public:
 	ColumnSegment &segment;
 	idx_t count;
 
+	//! Used to skip the vectors that cannot pass a filter
+	unique_ptr<CompressedRangeFilter> range_filter;
+
 	idx_t LeftInVector() const {
 		return AlpRDConstants::ALP_VECTOR_SIZE - (total_value_count % AlpRDConstants::ALP_VECTOR_SIZE);
 	}
@@ -248,4 +296,60 @@ void AlpRDScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
 	AlpRDScanPartial<T>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+void AlpRDFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+                 SelectionVector &sel, idx_t &sel_count, const TableFilter &filter, TableFilterState &filter_state) {
+	using EXACT_TYPE = typename FloatingToExact<T>::TYPE;
+	auto &scan_state = state.scan_state->Cast<AlpRDScanState<T>>();
+	if (!CompressedRangeFilter::Supports<T>(result.GetType(), filter)) {
+		// fallback: scan + filter
+		AlpRDScan<T>(segment, state, vector_count, result);
+		UnifiedVectorFormat vdata;
+		result.ToUnifiedFormat(vector_count, vdata);
+		ColumnSegment::FilterSelection(sel, result, vdata, filter, filter_state, vector_count, sel_count);
+		return;
+	}
+	if (!scan_state.range_filter) {
+		scan_state.range_filter = make_uniq<CompressedRangeFilter>(result.GetType());
+	}
+	CompressedRangeFilter &range_filter = *scan_state.range_filter;
+	range_filter.Reset();
+
+	auto result_data = FlatVector::GetDataUnsafe<EXACT_TYPE>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+
+	idx_t scanned = 0;
+	while (scanned < vector_count) {
+		const auto to_scan = MinValue(vector_count - scanned, scan_state.LeftInVector());
+		const auto alp_vector_size =
+		    MinValue<idx_t>(AlpRDConstants::ALP_VECTOR_SIZE, scan_state.count - scan_state.total_value_count);
+		if (!scan_state.VectorFinished() || to_scan != alp_vector_size) {
+			// only part of the ALP vector is scanned, which requires decoding it
+			range_filter.AddRange(scanned, scanned + to_scan);
+			scan_state.template ScanVector<EXACT_TYPE>(result_data + scanned, to_scan);
+			scanned += to_scan;
+			continue;
+		}
+		// load the ALP vector without decoding it, and only decode it if values in its range can pass the filter
+		scan_state.template LoadVector<true>(nullptr);
+		T min;
+		T max;
+		FilterPropagateResult vector_result;
+		if (scan_state.vector_state.GetValueRange(min, max)) {
+			vector_result = range_filter.CheckRange<T>(filter, scanned, scanned + to_scan, min, max);
+		} else {
+			vector_result = range_filter.AddRange(scanned, scanned + to_scan);
+		}
+		if (vector_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			scan_state.vector_state.template LoadValues<false>(result_data + scanned, to_scan);
+		}
+		scan_state.total_value_count += to_scan;
+		scanned += to_scan;
+	}
+	range_filter.Apply(result, vector_count, sel, sel_count, filter, filter_state);
+}
+
 } // namespace duckdb
@@ -45,6 +45,8 @@ public:
 	idx_t dictionary_size;
 	StringDictionaryContainer dict;
 	idx_t block_size;
+	//! Whether or not each dictionary entry passes the pushed down filter, computed once per segment
+	unsafe_unique_array<bool> filter_result;
 };
 
 } // namespace duckdb
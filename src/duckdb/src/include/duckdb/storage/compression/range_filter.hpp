@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/range_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/filter_propagate_result.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+
+namespace duckdb {
+class TableFilter;
+struct TableFilterState;
+class Vector;
+
+//! CompressedRangeFilter is used by compression filter functions that know the value range of parts of a vector from
+//! the compressed metadata (e.g. the frame of reference and bit width of a bitpacking group). Parts that cannot pass
+//! the filter are not decoded, parts that always pass are not compared, only the rows of the remaining parts are
+class CompressedRangeFilter {
+public:
+	explicit CompressedRangeFilter(const LogicalType &type);
+
+public:
+	//! Whether the value ranges of a vector of the given type (with physical type T) can be checked against the filter
+	template <class T>
+	static bool Supports(const LogicalType &type, const TableFilter &filter) {
+		return type.InternalType() == GetTypeId<T>() && SupportsFilter(type, filter);
+	}
+
+	//! Start filtering a new vector
+	void Reset() {
+		ranges.clear();
+	}
+	//! Check the filter against the values [min, max] of the rows [start, end) of the vector and record the result
+	template <class T>
+	FilterPropagateResult CheckRange(const TableFilter &filter, idx_t start, idx_t end, T min, T max) {
+		NumericStats::SetMin<T>(stats, min);
+		NumericStats::SetMax<T>(stats, max);
+		return AddRange(start, end, CheckStatistics(filter));
+	}
+	//! Record the rows [start, end) of the vector, which have the given filter result
+	FilterPropagateResult AddRange(idx_t start, idx_t end,
+	                               FilterPropagateResult result = FilterPropagateResult::NO_PRUNING_POSSIBLE);
+	//! Apply the filter to the selected rows of the vector, only the rows of unpruned ranges have to be decoded
+	void Apply(Vector &result, idx_t vector_count, SelectionVector &sel, idx_t &sel_count, const TableFilter &filter,
+	           TableFilterState &filter_state) const;
+
+	//! Whether the filter only consists of comparisons with constants that can be checked against value ranges
+	static bool SupportsFilter(const LogicalType &type, const TableFilter &filter);
+
+private:
+	FilterPropagateResult CheckStatistics(const TableFilter &filter);
+
+private:
+	struct FilterRange {
+		idx_t start;
+		idx_t end;
+		FilterPropagateResult result;
+	};
+
+	//! Statistics that are reused to check the ranges
+	BaseStatistics stats;
+	//! The ranges of the current vector
+	vector<FilterRange> ranges;
+};
+
+} // namespace duckdb
@@ -65,6 +65,9 @@ public:
 	          const vector<StorageIndex> &bound_columns, Expression &cast_expr);
 	//! Constructs a DataTable as a delta on an existing data table but with one column added new constraint
 	DataTable(ClientContext &context, DataTable &parent, BoundConstraint &constraint);
+	//! Constructs a DataTable as a delta on an existing data table but with a Bloom filter declared or dropped for
+	//! one column
+	DataTable(ClientContext &context, DataTable &parent, idx_t changed_idx, bool bloom_filter);
 
 	//! A reference to the database instance
 	AttachedDatabase &db;
@@ -17,6 +17,7 @@
 #include "duckdb/common/vector.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/common/encryption_functions.hpp"
+#include "duckdb/storage/buffer/block_read_ahead.hpp"
 
 namespace duckdb {
 
@@ -56,9 +57,12 @@ struct StorageManagerOptions {
 class SingleFileBlockManager : public BlockManager {
 	//! The location in the file where the block writing starts
 	static constexpr uint64_t BLOCK_START = Storage::FILE_HEADER_SIZE * 3;
+	//! The blocks that are scheduled for read-ahead may use up to 1/READ_AHEAD_MEMORY_FRACTION of the memory limit
+	static constexpr idx_t READ_AHEAD_MEMORY_FRACTION = 8;
 
 public:
 	SingleFileBlockManager(AttachedDatabase &db_p, const string &path_p, const StorageManagerOptions &options_p);
+	~SingleFileBlockManager() override;
 
 	FileOpenFlags GetFileFlags(bool create_new) const;
 	//! Creates a new database.
@@ -93,6 +97,9 @@ public:
 	void ReadBlock(data_ptr_t internal_buffer, uint64_t block_size, bool skip_block_header = false) const;
 	//! Read the content of a range of blocks into a buffer
 	void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) override;
+	//! Read multiple ranges of blocks with a single batch of reads on the file
+	void ReadBlocksBatch(vector<BlockReadRequest> &requests) override;
+	bool SupportsConcurrentBlockReads() override;
 	//! Write the block to disk. Use Write with client context instead.
 	void Write(FileBuffer &buffer, block_id_t block_id) override;
 	//! Write the block to disk.
@@ -113,6 +120,8 @@ public:
 	idx_t FreeBlocks() override;
 	//! Whether or not the attached database is a remote file
 	bool IsRemote() override;
+	//! Loads the blocks in the background if "read_ahead_threads" is set
+	void ReadAhead(vector<shared_ptr<BlockHandle>> &handles) override;
 
 private:
 	//! Loads the free list of the file.
@@ -184,5 +193,9 @@ private:
 	StorageManagerOptions options;
 	//! Lock for performing various operations in the single file block manager
 	mutex block_lock;
+	//! Lock for lazily creating the read-ahead threads
+	mutex read_ahead_lock;
+	//! The background read-ahead of blocks for scans (if enabled)
+	unique_ptr<BlockReadAhead> read_ahead;
 };
 } // namespace duckdb
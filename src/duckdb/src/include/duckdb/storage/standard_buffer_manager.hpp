@@ -32,6 +32,8 @@ struct EvictionQueue;
 class StandardBufferManager : public BufferManager {
 	friend class BufferHandle;
 	friend class BlockHandle;
+	//! The maximum amount of blocks that are read into intermediate buffers by a single batch of reads
+	static constexpr idx_t MAX_BATCH_READ_BLOCKS = 128;
 	friend class BlockManager;
 
 public:
@@ -159,6 +161,12 @@ protected:
 
 	void BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
 	               block_id_t first_block, block_id_t last_block);
+	//! Reads multiple ranges of blocks with a single batch of reads
+	void BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
+	               const vector<pair<block_id_t, block_id_t>> &ranges);
+	//! Loads the blocks of a range from the buffer they were read into
+	void LoadBatch(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
+	               block_id_t first_block, idx_t block_count, BufferHandle &intermediate_buffer);
 
 protected:
 	// These are stored here because temp_directory creation is lazy
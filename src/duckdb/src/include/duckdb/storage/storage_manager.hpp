@@ -84,6 +84,15 @@ public:
 	optional_ptr<WriteAheadLog> GetWAL();
 	//! Deletes the WAL file, and resets the unique pointer.
 	void ResetWAL();
+	//! Directs subsequent commits to a new WAL, so that they can proceed while a checkpoint writes the contents of
+	//! the current WAL to the database file. Returns false if there is nothing to rotate, or if a previously rotated
+	//! WAL has not been checkpointed yet.
+	bool RotateWAL();
+	//! Moves the WAL that commits were directed to by RotateWAL back to the regular WAL path. Called after the
+	//! checkpoint finished, when no commits are writing to the WAL.
+	void EndWALRotation();
+	//! The WALs whose contents are covered by a checkpoint
+	vector<reference<WriteAheadLog>> GetCheckpointWALs();
 
 	//! Returns the database file path
 	string GetDBPath() const {
@@ -93,7 +102,7 @@ public:
 		return load_complete;
 	}
 	//! The path to the WAL, derived from the database file path
-	string GetWALPath();
+	string GetWALPath(const string &suffix = ".wal");
 	bool InMemory();
 
 	virtual bool AutomaticCheckpoint(idx_t estimated_wal_bytes) = 0;
@@ -126,6 +135,10 @@ protected:
 	string path;
 	//! The WriteAheadLog of the storage manager
 	unique_ptr<WriteAheadLog> wal;
+	//! The WAL that commits were written to before RotateWAL, if it has not been checkpointed yet
+	unique_ptr<WriteAheadLog> rotated_wal;
+	//! Whether a checkpoint that only covers the rotated WAL is running, while commits are written to the WAL
+	bool checkpointing_rotated_wal = false;
 	//! Whether or not the database is opened in read-only mode
 	bool read_only;
 	//! When loading a database, we do not yet set the wal-field. Therefore, GetWriteAheadLog must
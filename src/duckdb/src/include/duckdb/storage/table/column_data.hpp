@@ -21,6 +21,7 @@
 #include "duckdb/common/atomic_ptr.hpp"
 
 namespace duckdb {
+class BlockedBloomFilter;
 class ColumnData;
 class ColumnSegment;
 class DatabaseInstance;
@@ -47,6 +48,7 @@ struct ColumnCheckpointInfo {
 
 public:
 	CompressionType GetCompressionType();
+	bool HasBloomFilter();
 };
 
 class ColumnData {
@@ -177,6 +179,18 @@ public:
 	virtual void Verify(RowGroup &parent);
 
 	FilterPropagateResult CheckZonemap(TableFilter &filter);
+	//! Check the statistics of a single vector of the row group against the filter, if the column has them
+	FilterPropagateResult CheckVectorZonemap(ColumnScanState &state, idx_t vector_index, TableFilter &filter);
+	//! Whether statistics are kept for every vector of the column (top-level columns with min/max statistics)
+	bool KeepsVectorStatistics() const;
+	//! Update the statistics of a vector with the values [offset, offset + count) of the data
+	static void UpdateVectorStatistics(BaseStatistics &stats, const UnifiedVectorFormat &vdata, idx_t offset,
+	                                   idx_t count);
+	//! Check equality filters against the Bloom filter of the row group, if the column has one
+	FilterPropagateResult CheckBloomFilter(const TableFilter &filter);
+	shared_ptr<BlockedBloomFilter> GetBloomFilter() const;
+	//! Whether a Bloom filter can be built for values of the given type
+	static bool SupportsBloomFilter(const LogicalType &type);
 
 	static shared_ptr<ColumnData> CreateColumn(BlockManager &block_manager, DataTableInfo &info, idx_t column_index,
 	                                           idx_t start_row, const LogicalType &type,
@@ -217,6 +231,12 @@ protected:
 
 	idx_t GetVectorCount(idx_t vector_index) const;
 
+	//! Replace the statistics of the vectors of the row group
+	void SetVectorStatistics(shared_ptr<const vector<BaseStatistics>> new_stats);
+	//! Get the statistics of the vectors of the row group, rebuilding them after the column was loaded
+	shared_ptr<const vector<BaseStatistics>> LoadVectorStatistics();
+	void SetBloomFilter(shared_ptr<BlockedBloomFilter> new_filter);
+
 private:
 	void UpdateCompressionFunction(SegmentLock &l, const CompressionFunction &function);
 
@@ -231,6 +251,14 @@ protected:
 	mutable mutex stats_lock;
 	//! The stats of the root segment
 	unique_ptr<SegmentStatistics> stats;
+	//! The stats of the complete vectors of the row group, used to skip vectors that cannot pass a filter.
+	//! They are kept in memory only. They are never modified, only replaced, so scans can keep using a snapshot
+	//! without holding the lock.
+	shared_ptr<const vector<BaseStatistics>> vector_stats;
+	//! Whether the vector stats can be rebuilt from the persistent segments on first use (after loading the column)
+	bool rebuild_vector_stats = false;
+	//! The Bloom filter over the values of the row group, used to skip the row group for equality filters
+	shared_ptr<BlockedBloomFilter> bloom_filter;
 	//! Total transient allocation size
 	atomic<idx_t> allocation_size;
 
@@ -256,6 +284,8 @@ struct PersistentColumnData {
 	PhysicalType physical_type;
 	vector<DataPointer> pointers;
 	vector<PersistentColumnData> child_columns;
+	//! The Bloom filter over the values of the row group (if any)
+	shared_ptr<BlockedBloomFilter> bloom_filter;
 	bool has_updates = false;
 
 	void Serialize(Serializer &serializer) const;
@@ -88,6 +88,10 @@ private:
 	vector<vector<optional_ptr<CompressionFunction>>> compression_functions;
 	//! For every column data that is being checkpointed, the analyze state of functions being tried
 	vector<vector<unique_ptr<AnalyzeState>>> analyze_states;
+	//! For every column data that is being checkpointed, the statistics of each vector of the row group (if kept)
+	vector<vector<BaseStatistics>> vector_stats;
+	//! For every column data that is being checkpointed, the Bloom filter over the values of the row group (if built)
+	vector<shared_ptr<BlockedBloomFilter>> bloom_filters;
 };
 
 } // namespace duckdb
@@ -53,12 +53,16 @@ class StorageCommitState;
 
 struct RowGroupWriteInfo {
 	RowGroupWriteInfo(PartialBlockManager &manager, const vector<CompressionType> &compression_types,
+	                  const vector<bool> &bloom_filters,
 	                  CheckpointType checkpoint_type = CheckpointType::FULL_CHECKPOINT)
-	    : manager(manager), compression_types(compression_types), checkpoint_type(checkpoint_type) {
+	    : manager(manager), compression_types(compression_types), bloom_filters(bloom_filters),
+	      checkpoint_type(checkpoint_type) {
 	}
 
 	PartialBlockManager &manager;
 	const vector<CompressionType> &compression_types;
+	//! Whether a Bloom filter is built for each of the columns
+	const vector<bool> &bloom_filters;
 	CheckpointType checkpoint_type;
 };
 
@@ -116,6 +120,9 @@ public:
 	//! Checks the given set of table filters against the per-segment statistics. Returns false if any segments were
 	//! skipped.
 	bool CheckZonemapSegments(CollectionScanState &state);
+	//! Starts loading the blocks of the scanned columns of this row group in the background, if read-ahead is
+	//! enabled for the underlying block manager
+	void ReadAhead(CollectionScanState &state);
 	void Scan(TransactionData transaction, CollectionScanState &state, DataChunk &result);
 	void ScanCommitted(CollectionScanState &state, DataChunk &result, TableScanType type);
 
@@ -22,6 +22,7 @@
 
 namespace duckdb {
 class AdaptiveFilter;
+class BaseStatistics;
 class ColumnSegment;
 class LocalTableStorage;
 class CollectionScanState;
@@ -103,6 +104,10 @@ struct ColumnScanState {
 	vector<bool> scan_child_column;
 	//! Contains TableScan level config for scanning
 	optional_ptr<TableScanOptions> scan_options;
+	//! Snapshot of the statistics of the vectors of the row group, taken when the first vector is checked
+	shared_ptr<const vector<BaseStatistics>> vector_stats;
+	//! Whether the snapshot of the vector statistics has been taken
+	bool vector_stats_loaded = false;
 
 public:
 	void Initialize(const LogicalType &type, const vector<StorageIndex> &children,
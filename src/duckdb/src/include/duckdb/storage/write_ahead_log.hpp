@@ -118,6 +118,8 @@ public:
 	void Truncate(idx_t size);
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
+	//! Move the WAL file on disk to the given path. The file is reopened at the new path when it is written to next.
+	void Move(const string &new_path);
 	void Flush();
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
@@ -53,6 +53,10 @@ public:
 	void PushCatalogEntry(CatalogEntry &entry, data_ptr_t extra_data, idx_t extra_data_size);
 
 	void SetReadWrite() override;
+	void SetAppendOnly() override;
+	void UpgradeAppendOnly() override;
+	//! Obtains a shared checkpoint lock if the transaction does not hold one yet
+	void AcquireCheckpointLock();
 
 	bool ShouldWriteToWAL(AttachedDatabase &db);
 	ErrorData WriteToWAL(AttachedDatabase &db, unique_ptr<StorageCommitState> &commit_state) noexcept;
@@ -83,6 +87,7 @@ public:
 
 	unique_ptr<StorageLockKey> TryGetCheckpointLock();
 	bool HasWriteLock() const {
+		lock_guard<mutex> guard(write_lock_lock);
 		return write_lock.get();
 	}
 
@@ -100,6 +105,8 @@ private:
 	unique_ptr<LocalStorage> storage;
 	//! Write lock
 	unique_ptr<StorageLockKey> write_lock;
+	//! Lock for write_lock - optimistic writes can obtain the checkpoint lock from multiple threads
+	mutable mutex write_lock_lock;
 	//! Lock for accessing sequence_usage
 	mutex sequence_lock;
 	//! Map of all sequences that were used during the transaction and the value they had in this transaction
@@ -14,7 +14,10 @@
 #include "duckdb/common/queue.hpp"
 
 namespace duckdb {
+class DataTable;
 class DuckTransaction;
+class ProducerToken;
+struct BackgroundCheckpointState;
 struct UndoBufferProperties;
 
 //! CleanupInfo collects transactions awaiting cleanup.
@@ -46,6 +49,13 @@ public:
 	void RollbackTransaction(Transaction &transaction) override;
 
 	void Checkpoint(ClientContext &context, bool force = false) override;
+	//! Performs an automatic checkpoint that was scheduled by a commit, if the WAL is still over the threshold and no
+	//! write transactions are active. Transactions that only append to tables can commit while it runs.
+	void BackgroundCheckpoint();
+	//! Stops scheduling background checkpoints and waits for a running background checkpoint to finish
+	void StopBackgroundCheckpoints();
+	//! Called by the checkpointer after the data of a table has been written
+	void OnTableCheckpointed(DataTable &table);
 
 	transaction_t LowestActiveId() const {
 		return lowest_active_id;
@@ -80,6 +90,8 @@ protected:
 		bool can_checkpoint;
 		string reason;
 		CheckpointType type;
+		//! Whether the checkpoint is left to a background thread
+		bool background = false;
 	};
 
 private:
@@ -93,6 +105,10 @@ private:
 	//! Whether or not we can checkpoint
 	CheckpointDecision CanCheckpoint(DuckTransaction &transaction, unique_ptr<StorageLockKey> &checkpoint_lock,
 	                                 const UndoBufferProperties &properties);
+	//! Schedule an automatic checkpoint on the task scheduler, unless one is already scheduled
+	void ScheduleBackgroundCheckpoint();
+	//! Waits for commits that write to the WAL while a background checkpoint is running, and ends the WAL rotation
+	void EndBackgroundCheckpointCommits();
 
 private:
 	//! The current start timestamp used by transactions
@@ -132,6 +148,11 @@ private:
 	//! inverting the cleanup order can result in catalog errors.
 	queue<unique_ptr<DuckCleanupInfo>> cleanup_queue;
 
+	//! State shared with the scheduled background checkpoint task
+	shared_ptr<BackgroundCheckpointState> background_checkpoint;
+	//! Producer used to schedule background checkpoints (created on first use)
+	unique_ptr<ProducerToken> background_checkpoint_producer;
+
 protected:
 	virtual void OnCommitCheckpointDecision(const CheckpointDecision &decision, DuckTransaction &transaction) {
 	}
@@ -99,6 +99,7 @@ public:
 	LocalTableStorage &GetOrCreateStorage(ClientContext &context, DataTable &table);
 	idx_t EstimatedSize() const;
 	bool IsEmpty() const;
+	vector<reference<DataTable>> GetTables() const;
 	void InsertEntry(DataTable &table, shared_ptr<LocalTableStorage> entry);
 
 private:
@@ -167,8 +168,12 @@ public:
 
 	void DropTable(DataTable &table);
 	bool Find(DataTable &table);
+	//! The tables this transaction has local changes for
+	vector<reference<DataTable>> GetTables() const;
 
 	idx_t AddedRows(DataTable &table);
+	//! Whether committing the changes to the given table writes row groups to disk
+	bool WritesRowGroupsOnCommit(DataTable &table);
 	vector<PartitionStatistics> GetPartitionStats(DataTable &table) const;
 
 	void AddColumn(DataTable &old_dt, DataTable &new_dt, ColumnDefinition &new_column,
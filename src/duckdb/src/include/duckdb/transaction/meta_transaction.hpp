@@ -56,7 +56,9 @@ public:
 
 	void SetReadOnly();
 	bool IsReadOnly() const;
-	void ModifyDatabase(AttachedDatabase &db);
+	//! Marks the given database as modified by this transaction - append_only indicates the modifying statement only
+	//! appends to tables
+	void ModifyDatabase(AttachedDatabase &db, bool append_only = false);
 	optional_ptr<AttachedDatabase> ModifiedDatabase() {
 		return modified_database;
 	}
@@ -73,6 +75,8 @@ private:
 	vector<reference<AttachedDatabase>> all_transactions;
 	//! The database we are modifying - we can only modify one database per transaction
 	optional_ptr<AttachedDatabase> modified_database;
+	//! Whether or not all statements that modified the database only appended to tables
+	bool modified_database_append_only = false;
 	//! Whether or not the meta transaction is marked as read only
 	bool is_read_only;
 };
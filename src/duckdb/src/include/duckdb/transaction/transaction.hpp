@@ -57,6 +57,10 @@ public:
 	DUCKDB_API bool IsReadOnly();
 	//! Promotes the transaction to a read-write transaction
 	DUCKDB_API virtual void SetReadWrite();
+	//! Promotes the transaction to a read-write transaction that (so far) only appends to tables
+	DUCKDB_API virtual void SetAppendOnly();
+	//! Promotes a transaction that only appended to tables to a regular read-write transaction
+	DUCKDB_API virtual void UpgradeAppendOnly();
 
 	virtual bool IsDuckTransaction() const {
 		return false;
@@ -241,6 +241,11 @@ void AttachedDatabase::Close() {
 	}
 	is_closed = true;
 
+	if (transaction_manager && transaction_manager->IsDuckTransactionManager()) {
+		// wait for a running background checkpoint before the storage is checkpointed and destroyed
+		DuckTransactionManager::Get(*this).StopBackgroundCheckpoints();
+	}
+
 	if (!IsSystem() && !catalog->InMemory()) {
 		db.GetDatabaseManager().EraseDatabasePath(catalog->GetDBPath());
 	}
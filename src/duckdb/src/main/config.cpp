@@ -77,6 +77,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AutoinstallExtensionRepositorySetting),
     DUCKDB_GLOBAL(AutoinstallKnownExtensionsSetting),
     DUCKDB_GLOBAL(AutoloadKnownExtensionsSetting),
+    DUCKDB_GLOBAL(BackgroundCheckpointSetting),
     DUCKDB_GLOBAL(CatalogErrorMaxSchemasSetting),
     DUCKDB_GLOBAL(CheckpointThresholdSetting),
     DUCKDB_GLOBAL_ALIAS("wal_autocheckpoint", CheckpointThresholdSetting),
@@ -87,6 +88,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(DebugCheckpointAbortSetting),
     DUCKDB_LOCAL(DebugForceExternalSetting),
     DUCKDB_LOCAL(DebugForceNoCrossProductSetting),
+    DUCKDB_GLOBAL(DebugIoUringFailureSetting),
     DUCKDB_GLOBAL(DebugSkipCheckpointOnCommitSetting),
     DUCKDB_GLOBAL(DebugVerifyVectorSetting),
     DUCKDB_GLOBAL(DebugWindowModeSetting),
@@ -96,6 +98,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL_ALIAS("null_order", DefaultNullOrderSetting),
     DUCKDB_GLOBAL(DefaultOrderSetting),
     DUCKDB_GLOBAL(DefaultSecretStorageSetting),
+    DUCKDB_LOCAL(DictionaryEncodeJoinPayloadsSetting),
     DUCKDB_GLOBAL(DisableDatabaseInvalidationSetting),
     DUCKDB_LOCAL(DisableTimestamptzCastsSetting),
     DUCKDB_GLOBAL(DisabledCompressionMethodsSetting),
@@ -167,8 +170,11 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(ProfilingCoverageSetting),
     DUCKDB_LOCAL(ProfilingModeSetting),
     DUCKDB_LOCAL(ProgressBarTimeSetting),
+    DUCKDB_GLOBAL(ReadAheadThreadsSetting),
     DUCKDB_LOCAL(ScalarSubqueryErrorOnMultipleRowsSetting),
+    DUCKDB_GLOBAL(SchedulerFairQueuingSetting),
     DUCKDB_GLOBAL(SchedulerProcessPartialSetting),
+    DUCKDB_LOCAL(SchedulerWeightSetting),
     DUCKDB_LOCAL(SchemaSetting),
     DUCKDB_LOCAL(SearchPathSetting),
     DUCKDB_GLOBAL(SecretDirectorySetting),
@@ -12,6 +12,7 @@
 #include "duckdb/main/settings.hpp"
 
 #include "duckdb/common/enums/access_mode.hpp"
+#include "duckdb/common/io_uring.hpp"
 #include "duckdb/catalog/catalog_search_path.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/attached_database.hpp"
@@ -350,6 +351,22 @@ Value ArrowOutputVersionSetting::GetSetting(const ClientContext &context) {
 	return Value(arrow_version);
 }
 
+//===----------------------------------------------------------------------===//
+// Background Checkpoint
+//===----------------------------------------------------------------------===//
+void BackgroundCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint = input.GetValue<bool>();
+}
+
+void BackgroundCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint = DBConfig().options.background_checkpoint;
+}
+
+Value BackgroundCheckpointSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_checkpoint);
+}
+
 //===----------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===----------------------------------------------------------------------===//
@@ -474,6 +491,38 @@ void CustomUserAgentSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config)
 	config.options.custom_user_agent = DBConfig().options.custom_user_agent;
 }
 
+//===----------------------------------------------------------------------===//
+// Debug IO Uring Failure
+//===----------------------------------------------------------------------===//
+void DebugIoUringFailureSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	if (parameter == "none") {
+		IOUring::SetFailureInjection(IOUringFailure::NONE);
+	} else if (parameter == "submit") {
+		IOUring::SetFailureInjection(IOUringFailure::SUBMIT);
+	} else if (parameter == "wait") {
+		IOUring::SetFailureInjection(IOUringFailure::WAIT);
+	} else {
+		throw InvalidInputException(
+		    "Unrecognized value for debug_io_uring_failure: '%s'. Expected none, submit or wait", parameter);
+	}
+}
+
+void DebugIoUringFailureSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	IOUring::SetFailureInjection(IOUringFailure::NONE);
+}
+
+Value DebugIoUringFailureSetting::GetSetting(const ClientContext &context) {
+	switch (IOUring::GetFailureInjection()) {
+	case IOUringFailure::SUBMIT:
+		return Value("submit");
+	case IOUringFailure::WAIT:
+		return Value("wait");
+	default:
+		return Value("none");
+	}
+}
+
 //===----------------------------------------------------------------------===//
 // Default Block Size
 //===----------------------------------------------------------------------===//
@@ -587,6 +636,23 @@ Value DefaultSecretStorageSetting::GetSetting(const ClientContext &context) {
 	return config.secret_manager->DefaultStorage();
 }
 
+//===----------------------------------------------------------------------===//
+// Dictionary Encode Join Payloads
+//===----------------------------------------------------------------------===//
+void DictionaryEncodeJoinPayloadsSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.dictionary_encode_join_payloads = input.GetValue<bool>();
+}
+
+void DictionaryEncodeJoinPayloadsSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).dictionary_encode_join_payloads = ClientConfig().dictionary_encode_join_payloads;
+}
+
+Value DictionaryEncodeJoinPayloadsSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::BOOLEAN(config.dictionary_encode_join_payloads);
+}
+
 //===----------------------------------------------------------------------===//
 // Disabled Compression Methods
 //===----------------------------------------------------------------------===//
@@ -1421,6 +1487,67 @@ Value ProgressBarTimeSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===----------------------------------------------------------------------===//
+// Read Ahead Threads
+//===----------------------------------------------------------------------===//
+void ReadAheadThreadsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.read_ahead_threads = input.GetValue<idx_t>();
+}
+
+void ReadAheadThreadsSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.read_ahead_threads = DBConfig().options.read_ahead_threads;
+}
+
+Value ReadAheadThreadsSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.read_ahead_threads);
+}
+
+//===----------------------------------------------------------------------===//
+// Scheduler Fair Queuing
+//===----------------------------------------------------------------------===//
+void SchedulerFairQueuingSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.scheduler_fair_queuing = input.GetValue<bool>();
+}
+
+void SchedulerFairQueuingSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.scheduler_fair_queuing = DBConfig().options.scheduler_fair_queuing;
+}
+
+Value SchedulerFairQueuingSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.scheduler_fair_queuing);
+}
+
+//===----------------------------------------------------------------------===//
+// Scheduler Weight
+//===----------------------------------------------------------------------===//
+void SchedulerWeightSetting::SetLocal(ClientContext &context, const Value &input) {
+	if (!OnLocalSet(context, input)) {
+		return;
+	}
+	auto &config = ClientConfig::GetConfig(context);
+	config.scheduler_weight = input.GetValue<idx_t>();
+}
+
+void SchedulerWeightSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).scheduler_weight = ClientConfig().scheduler_weight;
+}
+
+Value SchedulerWeightSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::UBIGINT(config.scheduler_weight);
+}
+
+bool SchedulerWeightSetting::OnLocalSet(ClientContext &context, const Value &input) {
+	const auto param = input.GetValue<uint64_t>();
+	if (param == 0 || param > TaskScheduler::MAX_PRODUCER_WEIGHT) {
+		throw InvalidInputException("Invalid value for scheduler_weight, value must be between 1 and %llu",
+		                            idx_t(TaskScheduler::MAX_PRODUCER_WEIGHT));
+	}
+	return true;
+}
+
 //===----------------------------------------------------------------------===//
 // Schema
 //===----------------------------------------------------------------------===//
@@ -250,6 +250,9 @@ idx_t ExpressionHeuristics::Cost(TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 		return 5;
+	case TableFilterType::BLOOM_FILTER:
+		// hashing + a random memory access per row
+		return 20;
 	case TableFilterType::STRUCT_EXTRACT: {
 		auto &struct_filter = filter.Cast<StructFilter>();
 		return Cost(*struct_filter.child_filter);
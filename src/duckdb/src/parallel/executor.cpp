@@ -387,7 +387,7 @@ void Executor::InitializeInternal(PhysicalOperator &plan) {
 
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(plan);
-		this->producer = scheduler.CreateProducer();
+		this->producer = scheduler.CreateProducer(ClientConfig::GetConfig(context).scheduler_weight);
 
 		// build and ready the pipelines
 		PipelineBuildState state;
@@ -1,8 +1,12 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 
 #include "duckdb/common/chrono.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/numa.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/queue.hpp"
+#include "duckdb/logging/logger.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 
@@ -84,6 +88,80 @@ bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task>
 	return q.try_dequeue_from_producer(token.token->queue_token, task);
 }
 
+//! The local task queue of a single worker thread
+//! The owning worker pushes and pops at the back (most recently scheduled first, while its input is still in cache)
+//! Other workers steal from the front
+struct WorkerQueue {
+	WorkerQueue(idx_t numa_node, bool pinned_to_node) : numa_node(numa_node), pinned_to_node(pinned_to_node) {
+	}
+
+	mutex lock;
+	deque<shared_ptr<Task>> tasks;
+	//! The NUMA node the worker is pinned to (0 if threads are not pinned to NUMA nodes)
+	const idx_t numa_node;
+	//! Whether the worker is pinned to the CPUs of its NUMA node
+	const bool pinned_to_node;
+
+	//! Returns the number of tasks in the queue after adding the task
+	idx_t Push(shared_ptr<Task> task);
+	bool Pop(shared_ptr<Task> &task);
+	bool Steal(shared_ptr<Task> &task);
+	bool PopFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	bool IsEmpty();
+};
+
+idx_t WorkerQueue::Push(shared_ptr<Task> task) {
+	lock_guard<mutex> guard(lock);
+	tasks.push_back(std::move(task));
+	return tasks.size();
+}
+
+bool WorkerQueue::Pop(shared_ptr<Task> &task) {
+	lock_guard<mutex> guard(lock);
+	if (tasks.empty()) {
+		return false;
+	}
+	task = std::move(tasks.back());
+	tasks.pop_back();
+	return true;
+}
+
+bool WorkerQueue::Steal(shared_ptr<Task> &task) {
+	lock_guard<mutex> guard(lock);
+	if (tasks.empty()) {
+		return false;
+	}
+	task = std::move(tasks.front());
+	tasks.pop_front();
+	return true;
+}
+
+bool WorkerQueue::PopFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
+	lock_guard<mutex> guard(lock);
+	for (auto it = tasks.rbegin(); it != tasks.rend(); it++) {
+		if ((*it)->token.get() == &token) {
+			task = std::move(*it);
+			tasks.erase(std::next(it).base());
+			return true;
+		}
+	}
+	return false;
+}
+
+bool WorkerQueue::IsEmpty() {
+	lock_guard<mutex> guard(lock);
+	return tasks.empty();
+}
+
+//! The scheduler and local queue of the current thread, only set for the background threads of a scheduler
+struct WorkerThreadState {
+	TaskScheduler *scheduler;
+	WorkerQueue *queue;
+	idx_t worker_idx;
+};
+
+static thread_local WorkerThreadState worker_thread_state {nullptr, nullptr, 0};
+
 #else
 struct ConcurrentQueue {
 	reference_map_t<QueueProducerToken, std::queue<shared_ptr<Task>>> q;
@@ -135,20 +213,68 @@ struct QueueProducerToken {
 private:
 	ConcurrentQueue *queue;
 };
+
+struct WorkerQueue {};
 #endif
 
+//! The fair queuing state of a producer
+struct FairQueueEntry {
+	explicit FairQueueEntry(ProducerToken &producer, idx_t weight) : producer(&producer), weight(weight) {
+	}
+
+	//! Protects the producer pointer: the token cannot be destroyed while tasks are dequeued from it
+	mutex lock;
+	//! The producer, set to nullptr when the producer token is destroyed
+	optional_ptr<ProducerToken> producer;
+	//! The share of the threads this producer gets relative to the other producers
+	const idx_t weight;
+	//! The virtual time of this producer (protected by the lock of the fair queue)
+	idx_t pass = 0;
+	//! Whether the producer is in the ready set of the fair queue (protected by the lock of the fair queue)
+	bool ready = false;
+};
+
+//! Stride scheduling over the producers that have tasks in the global queue: every task taken from a producer
+//! advances its virtual time by STRIDE / weight, and we always serve the producer with the lowest virtual time.
+//! Every running query then gets a share of the threads proportional to its weight, regardless of how many tasks it
+//! has scheduled.
+struct FairQueue {
+	static constexpr idx_t STRIDE = idx_t(1) << 20;
+
+	struct ReadyProducer {
+		idx_t pass;
+		shared_ptr<FairQueueEntry> entry;
+
+		bool operator<(const ReadyProducer &other) const {
+			// std::priority_queue is a max-heap - invert the comparison to get the lowest virtual time first
+			return pass > other.pass;
+		}
+	};
+
+	mutex lock;
+	//! The producers that (may) have tasks in the global queue. Producers whose tasks were taken in other ways (e.g.
+	//! by GetTaskFromProducer) are removed lazily, and re-added when they schedule new tasks.
+	std::priority_queue<ReadyProducer> ready;
+	//! The virtual time of the fair queue: the virtual time of the producer that was served last
+	idx_t global_pass = 0;
+};
+
 ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
     : scheduler(scheduler), token(std::move(token)) {
 }
 
 ProducerToken::~ProducerToken() {
+	if (fair_queue_entry) {
+		lock_guard<mutex> guard(fair_queue_entry->lock);
+		fair_queue_entry->producer = nullptr;
+	}
 }
 
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
-    : db(db), queue(make_uniq<ConcurrentQueue>()),
+    : db(db), queue(make_uniq<ConcurrentQueue>()), fair_queue(make_uniq<FairQueue>()),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold),
       allocator_background_threads(db.config.options.allocator_background_threads), requested_thread_count(0),
-      current_thread_count(1) {
+      current_thread_count(1), idle_worker_count(0) {
 	SetAllocatorBackgroundThreads(db.config.options.allocator_background_threads);
 }
 
@@ -170,56 +296,248 @@ TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
 	return db.GetScheduler();
 }
 
-unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(idx_t weight) {
 	auto token = make_uniq<QueueProducerToken>(*queue);
-	return make_uniq<ProducerToken>(*this, std::move(token));
+	auto producer = make_uniq<ProducerToken>(*this, std::move(token));
+	weight = MinValue<idx_t>(MaxValue<idx_t>(weight, 1), idx_t(MAX_PRODUCER_WEIGHT));
+	producer->fair_queue_entry = make_shared_ptr<FairQueueEntry>(*producer, weight);
+	return producer;
+}
+
+void TaskScheduler::MarkProducerReady(ProducerToken &token) {
+	auto &entry = token.fair_queue_entry;
+	lock_guard<mutex> guard(fair_queue->lock);
+	if (entry->ready) {
+		return;
+	}
+	// new producers and producers that were idle for a while continue from the current virtual time
+	// so they cannot bank credit
+	entry->pass = MaxValue(entry->pass, fair_queue->global_pass);
+	entry->ready = true;
+	fair_queue->ready.push(FairQueue::ReadyProducer {entry->pass, entry});
+}
+
+void TaskScheduler::EnqueueTask(ProducerToken &token, shared_ptr<Task> task) {
+	queue->Enqueue(token, std::move(task));
+	if (db.config.options.scheduler_fair_queuing) {
+		MarkProducerReady(token);
+	}
+}
+
+void TaskScheduler::EnqueueTasks(ProducerToken &token, vector<shared_ptr<Task>> &tasks) {
+	queue->EnqueueBulk(token, tasks);
+	if (db.config.options.scheduler_fair_queuing) {
+		MarkProducerReady(token);
+	}
+}
+
+bool TaskScheduler::DequeueTask(shared_ptr<Task> &task) {
+#ifndef DUCKDB_NO_THREADS
+	if (db.config.options.scheduler_fair_queuing) {
+		if (DequeueTaskFair(task)) {
+			return true;
+		}
+		// the global queue can hold tasks of producers that are not in the fair queue (e.g. tasks that were scheduled
+		// before fair queuing was enabled) - take them in FIFO order, but count them against the share of the producer
+		if (!queue->q.try_dequeue(task)) {
+			return false;
+		}
+		ChargeProducer(*task->token);
+		return true;
+	}
+	return queue->q.try_dequeue(task);
+#else
+	return false;
+#endif
+}
+
+void TaskScheduler::ChargeProducer(ProducerToken &token) {
+	auto &entry = token.fair_queue_entry;
+	lock_guard<mutex> guard(fair_queue->lock);
+	entry->pass = MaxValue(entry->pass, fair_queue->global_pass) + FairQueue::STRIDE / entry->weight;
+	if (!entry->ready) {
+		// the producer might have more tasks in the global queue - from now on they are dequeued by the fair queue
+		entry->ready = true;
+		fair_queue->ready.push(FairQueue::ReadyProducer {entry->pass, entry});
+	}
+}
+
+bool TaskScheduler::DequeueTaskFair(shared_ptr<Task> &task) {
+	idx_t weight;
+	idx_t ready_count;
+	{
+		lock_guard<mutex> guard(fair_queue->lock);
+		if (!DequeueTaskFairInternal(task, weight, ready_count)) {
+			return false;
+		}
+	}
+	DUCKDB_LOG_TRACE(db, "FairQueue dequeued a task of a producer with weight %llu, ready producers %llu", weight,
+	                 ready_count);
+	return true;
+}
+
+bool TaskScheduler::DequeueTaskFairInternal(shared_ptr<Task> &task, idx_t &weight, idx_t &ready_count) {
+	auto &ready = fair_queue->ready;
+	while (!ready.empty()) {
+		auto entry = ready.top().entry;
+		ready.pop();
+		bool dequeued;
+		{
+			lock_guard<mutex> entry_guard(entry->lock);
+			dequeued = entry->producer && queue->DequeueFromProducer(*entry->producer, task);
+		}
+		if (!dequeued) {
+			// the producer has no tasks left in the global queue (or it was destroyed)
+			// it is added again when it schedules new tasks
+			entry->ready = false;
+			continue;
+		}
+		fair_queue->global_pass = entry->pass;
+		entry->pass += FairQueue::STRIDE / entry->weight;
+		ready.push(FairQueue::ReadyProducer {entry->pass, entry});
+		weight = entry->weight;
+		ready_count = ready.size();
+		return true;
+	}
+	return false;
+}
+
+optional_ptr<WorkerQueue> TaskScheduler::GetLocalQueue() {
+#ifndef DUCKDB_NO_THREADS
+	if (worker_thread_state.scheduler == this) {
+		return worker_thread_state.queue;
+	}
+#endif
+	return nullptr;
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
+#ifndef DUCKDB_NO_THREADS
+	// with fair queuing all tasks go through the global queue, so the producer weights are respected
+	auto local_queue = db.config.options.scheduler_fair_queuing ? nullptr : GetLocalQueue();
+	if (local_queue) {
+		// scheduled from one of our worker threads (e.g. a follow-up task, or a task that was unblocked)
+		// keep the task on this thread, the worker runs it after its current task
+		task->token = token;
+		auto local_task_count = local_queue->Push(std::move(task));
+		if (local_task_count > 1 && idle_worker_count.load() > 0) {
+			// the worker has a backlog of local tasks - wake up an idle worker so it can steal from it
+			// if the task is gone by the time it wakes up, that worker goes back to sleep
+			queue->semaphore.signal();
+		}
+		return;
+	}
+#endif
 	// Enqueue a task for the given producer token and signal any sleeping threads
-	queue->Enqueue(token, std::move(task));
+	EnqueueTask(token, std::move(task));
 }
 
 void TaskScheduler::ScheduleTasks(ProducerToken &producer, vector<shared_ptr<Task>> &tasks) {
-	queue->EnqueueBulk(producer, tasks);
+#ifndef DUCKDB_NO_THREADS
+	if (!tasks.empty() && !db.config.options.scheduler_fair_queuing && GetLocalQueue()) {
+		// keep one task on the scheduling worker thread, the other tasks go to the global queue
+		ScheduleTask(producer, std::move(tasks.back()));
+		tasks.pop_back();
+		if (tasks.empty()) {
+			return;
+		}
+	}
+#endif
+	EnqueueTasks(producer, tasks);
 }
 
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	return queue->DequeueFromProducer(token, task);
+	if (queue->DequeueFromProducer(token, task)) {
+		return true;
+	}
+#ifndef DUCKDB_NO_THREADS
+	// a worker thread waiting on its own tasks must be able to find tasks it pushed to its local queue
+	auto local_queue = GetLocalQueue();
+	return local_queue && local_queue->PopFromProducer(token, task);
+#else
+	return false;
+#endif
+}
+
+bool TaskScheduler::StealTask(idx_t worker_idx, shared_ptr<Task> &task) {
+#ifndef DUCKDB_NO_THREADS
+	// start at the next worker, so that idle workers do not all try to steal from the same queue
+	// first steal from workers on the same NUMA node, so that tasks (and the data they touch) stay on the node
+	auto worker_count = worker_queues.size();
+	auto numa_node = worker_queues[worker_idx]->numa_node;
+	for (idx_t pass = 0; pass < 2; pass++) {
+		const bool same_node = pass == 0;
+		for (idx_t i = 1; i <= worker_count; i++) {
+			auto &worker_queue = *worker_queues[(worker_idx + i) % worker_count];
+			if ((worker_queue.numa_node == numa_node) != same_node) {
+				continue;
+			}
+			if (worker_queue.Steal(task)) {
+				return true;
+			}
+		}
+	}
+#endif
+	return false;
 }
 
 void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 #ifndef DUCKDB_NO_THREADS
 	static constexpr const int64_t INITIAL_FLUSH_WAIT = 500000; // initial wait time of 0.5s (in mus) before flushing
+	// after this many consecutive tasks from the local queue, check the global queue first so that other queries
+	// are not starved by a worker that keeps scheduling follow-up tasks for itself
+	static constexpr const idx_t GLOBAL_QUEUE_CHECK_INTERVAL = 61;
 
 	auto &config = DBConfig::GetConfig(db);
+	// only background threads of this scheduler have a local queue, external threads use the global queue
+	auto local_queue = GetLocalQueue();
+	idx_t local_task_count = 0;
 	shared_ptr<Task> task;
 	// loop until the marker is set to false
 	while (*marker) {
-		if (!Allocator::SupportsFlush()) {
-			// allocator can't flush, just start an untimed wait
-			queue->semaphore.wait();
-		} else if (!queue->semaphore.wait(INITIAL_FLUSH_WAIT)) {
-			// allocator can flush, we flush this threads outstanding allocations after it was idle for 0.5s
-			Allocator::ThreadFlush(allocator_background_threads, allocator_flush_threshold,
-			                       NumericCast<idx_t>(requested_thread_count.load()));
-			auto decay_delay = Allocator::DecayDelay();
-			if (!decay_delay.IsValid()) {
-				// no decay delay specified - just wait
+		bool has_task = false;
+		if (local_queue) {
+			if (local_task_count >= GLOBAL_QUEUE_CHECK_INTERVAL) {
+				local_task_count = 0;
+				has_task = DequeueTask(task);
+			}
+			if (!has_task && local_queue->Pop(task)) {
+				local_task_count++;
+				has_task = true;
+			}
+		}
+		if (!has_task) {
+			local_task_count = 0;
+			idle_worker_count++;
+			if (!Allocator::SupportsFlush()) {
+				// allocator can't flush, just start an untimed wait
 				queue->semaphore.wait();
-			} else {
-				if (!queue->semaphore.wait(UnsafeNumericCast<int64_t>(decay_delay.GetIndex()) * 1000000 -
-				                           INITIAL_FLUSH_WAIT)) {
-					// in total, the thread was idle for the entire decay delay (note: seconds converted to mus)
-					// mark it as idle and start an untimed wait
-					Allocator::ThreadIdle();
+			} else if (!queue->semaphore.wait(INITIAL_FLUSH_WAIT)) {
+				// allocator can flush, we flush this threads outstanding allocations after it was idle for 0.5s
+				Allocator::ThreadFlush(allocator_background_threads, allocator_flush_threshold,
+				                       NumericCast<idx_t>(requested_thread_count.load()));
+				auto decay_delay = Allocator::DecayDelay();
+				if (!decay_delay.IsValid()) {
+					// no decay delay specified - just wait
 					queue->semaphore.wait();
+				} else {
+					if (!queue->semaphore.wait(UnsafeNumericCast<int64_t>(decay_delay.GetIndex()) * 1000000 -
+					                           INITIAL_FLUSH_WAIT)) {
+						// in total, the thread was idle for the entire decay delay (note: seconds converted to mus)
+						// mark it as idle and start an untimed wait
+						Allocator::ThreadIdle();
+						queue->semaphore.wait();
+					}
 				}
 			}
+			idle_worker_count--;
+			// the signal might have been sent for a backlog in the local queue of another worker - try to steal from it
+			has_task = DequeueTask(task) || (local_queue && StealTask(worker_thread_state.worker_idx, task));
 		}
-		if (queue->q.try_dequeue(task)) {
-			auto process_mode = config.options.scheduler_process_partial ? TaskExecutionMode::PROCESS_PARTIAL
-			                                                             : TaskExecutionMode::PROCESS_ALL;
+		if (has_task) {
+			// with fair queuing tasks are processed partially, so long-running tasks give up their thread regularly
+			auto process_partial = config.options.scheduler_process_partial || config.options.scheduler_fair_queuing;
+			auto process_mode = process_partial ? TaskExecutionMode::PROCESS_PARTIAL : TaskExecutionMode::PROCESS_ALL;
 			auto execute_result = task->Execute(process_mode);
 
 			switch (execute_result) {
@@ -229,8 +547,9 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				break;
 			case TaskExecutionResult::TASK_NOT_FINISHED: {
 				// task is not finished - reschedule immediately
+				// this goes to the global queue so that partially processed tasks of different queries take turns
 				auto &token = *task->token;
-				queue->Enqueue(token, std::move(task));
+				EnqueueTask(token, std::move(task));
 				break;
 			}
 			case TaskExecutionResult::TASK_BLOCKED:
@@ -240,6 +559,13 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 			}
 		}
 	}
+	if (local_queue) {
+		// this thread will exit, hand the tasks left in its local queue over to the global queue
+		while (local_queue->Pop(task)) {
+			auto &token = *task->token;
+			EnqueueTask(token, std::move(task));
+		}
+	}
 	// this thread will exit, flush all of its outstanding allocations
 	if (Allocator::SupportsFlush()) {
 		Allocator::ThreadFlush(allocator_background_threads, 0, NumericCast<idx_t>(requested_thread_count.load()));
@@ -256,7 +582,7 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!DequeueTask(task)) {
 			return completed_tasks;
 		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -286,7 +612,7 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 	shared_ptr<Task> task;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!DequeueTask(task)) {
 			return;
 		}
 		try {
@@ -313,8 +639,17 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 }
 
 #ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
+static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker, WorkerQueue *worker_queue,
+                               idx_t worker_idx) {
+	worker_thread_state.scheduler = scheduler;
+	worker_thread_state.queue = worker_queue;
+	worker_thread_state.worker_idx = worker_idx;
+	if (worker_queue->pinned_to_node) {
+		Allocator::SetThreadNUMANode(worker_queue->numa_node);
+	}
 	scheduler->ExecuteForever(marker);
+	worker_thread_state.scheduler = nullptr;
+	worker_thread_state.queue = nullptr;
 }
 #endif
 
@@ -324,6 +659,7 @@ int32_t TaskScheduler::NumberOfThreads() {
 
 idx_t TaskScheduler::GetNumberOfTasks() const {
 #ifndef DUCKDB_NO_THREADS
+	// note: this does not include the tasks in the local queues of the worker threads
 	return queue->q.size_approx();
 #else
 	idx_t task_count = 0;
@@ -449,6 +785,28 @@ static void SetThreadAffinity(thread &thread, const int &cpu_id) {
 	pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuset);
 #endif
 }
+
+static void SetThreadAffinity(thread &thread, const vector<idx_t> &cpu_ids) {
+#if defined(__GLIBC__)
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+	for (auto &cpu_id : cpu_ids) {
+		if (cpu_id < CPU_SETSIZE) {
+			CPU_SET(cpu_id, &cpuset);
+		}
+	}
+	pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuset);
+#endif
+}
+
+static vector<vector<idx_t>> GetNUMANodeCPUs(DatabaseInstance &db) {
+	try {
+		return NUMA::GetNodeCPUs(*db.config.file_system);
+	} catch (std::exception &ex) {
+		// could not read the topology - don't pin the threads to NUMA nodes
+		return vector<vector<idx_t>>();
+	}
+}
 #endif
 
 void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
@@ -459,8 +817,10 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 		current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
 		return;
 	}
-	if (threads.size() > new_thread_count) {
-		// we are reducing the number of threads: clear all threads first
+	if (!threads.empty()) {
+		// we are changing the number of threads: clear all threads first
+		// the local queues are shared by all threads (for stealing), so they can only be replaced once all threads
+		// are stopped - the threads hand their outstanding local tasks over to the global queue before exiting
 		for (idx_t i = 0; i < threads.size(); i++) {
 			*markers[i] = false;
 		}
@@ -482,13 +842,31 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 		const auto pin_threads = db.config.options.pin_threads == ThreadPinMode::ON ||
 		                         (db.config.options.pin_threads == ThreadPinMode::AUTO &&
 		                          std::thread::hardware_concurrency() > THREAD_PIN_THRESHOLD);
+		// Whether to spread the threads over the NUMA nodes, pinning each thread to the cores of its node
+		// the threads of a node allocate from a per-node arena (see Allocator::SetThreadNUMANode)
+		// the buffer pool eviction queues are not per node, and partitioned operators do not assign partitions to
+		// the threads of a node: a partition is built from the data of every thread, so it has no home node
+		vector<vector<idx_t>> numa_nodes;
+		if (db.config.options.pin_threads == ThreadPinMode::NUMA) {
+			numa_nodes = GetNUMANodeCPUs(db);
+		}
+		const auto pin_numa_nodes = numa_nodes.size() > 1;
+
+		// create the local queues up front: they must not change while the threads are running
+		worker_queues.clear();
+		for (idx_t i = 0; i < create_new_threads; i++) {
+			worker_queues.push_back(make_uniq<WorkerQueue>(pin_numa_nodes ? i % numa_nodes.size() : 0, pin_numa_nodes));
+		}
 		for (idx_t i = 0; i < create_new_threads; i++) {
 			// launch a thread and assign it a cancellation marker
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
 			unique_ptr<thread> worker_thread;
 			try {
-				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get());
-				if (pin_threads) {
+				worker_thread =
+				    make_uniq<thread>(ThreadExecuteTasks, this, marker.get(), worker_queues[i].get(), threads.size());
+				if (pin_numa_nodes) {
+					SetThreadAffinity(*worker_thread, numa_nodes[worker_queues[i]->numa_node]);
+				} else if (pin_threads) {
 					SetThreadAffinity(*worker_thread, NumericCast<int>(threads.size()));
 				}
 			} catch (std::exception &ex) {
@@ -86,6 +86,20 @@ void ColumnDefinition::SetCompressionType(duckdb::CompressionType compression_ty
 	this->compression_type = compression_type;
 }
 
+static constexpr const char *BLOOM_FILTER_TAG = "bloom_filter";
+
+bool ColumnDefinition::HasBloomFilter() const {
+	return tags.find(BLOOM_FILTER_TAG) != tags.end();
+}
+
+void ColumnDefinition::SetBloomFilter(bool bloom_filter) {
+	if (bloom_filter) {
+		tags[BLOOM_FILTER_TAG] = "true";
+	} else {
+		tags.erase(BLOOM_FILTER_TAG);
+	}
+}
+
 const storage_t &ColumnDefinition::StorageOid() const {
 	return storage_oid;
 }
@@ -671,4 +671,33 @@ string SetSortedByInfo::ToString() const {
 	return result;
 }
 
+//===--------------------------------------------------------------------===//
+// SetBloomFilterInfo
+//===--------------------------------------------------------------------===//
+SetBloomFilterInfo::SetBloomFilterInfo() : AlterTableInfo(AlterTableType::SET_BLOOM_FILTER), bloom_filter(false) {
+}
+
+SetBloomFilterInfo::SetBloomFilterInfo(AlterEntryData data, string column_name_p, bool bloom_filter)
+    : AlterTableInfo(AlterTableType::SET_BLOOM_FILTER, std::move(data)), column_name(std::move(column_name_p)),
+      bloom_filter(bloom_filter) {
+}
+
+SetBloomFilterInfo::~SetBloomFilterInfo() {
+}
+
+unique_ptr<AlterInfo> SetBloomFilterInfo::Copy() const {
+	return make_uniq_base<AlterInfo, SetBloomFilterInfo>(GetAlterEntryData(), column_name, bloom_filter);
+}
+
+string SetBloomFilterInfo::ToString() const {
+	// there is no ALTER TABLE syntax for Bloom filters, they are declared with a PRAGMA
+	string result = "PRAGMA ";
+	result += bloom_filter ? "create_bloom_filter(" : "drop_bloom_filter(";
+	result += Value(QualifierToString(catalog, schema, name)).ToSQLString();
+	result += ", ";
+	result += Value(column_name).ToSQLString();
+	result += ");";
+	return result;
+}
+
 } // namespace duckdb
@@ -24,7 +24,9 @@
 #include "duckdb/planner/tableref/bound_dummytableref.hpp"
 #include "duckdb/parser/parsed_expression_iterator.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
+#include "duckdb/storage/data_table.hpp"
 #include "duckdb/parser/tableref/basetableref.hpp"
+#include "duckdb/main/config.hpp"
 
 namespace duckdb {
 
@@ -520,6 +522,19 @@ void Binder::BindInsertColumnList(TableCatalogEntry &table, vector<string> &colu
 	}
 }
 
+//! Plain inserts into tables without indexes or foreign keys only append to the table when they commit
+static bool IsAppendOnlyTable(TableCatalogEntry &table) {
+	if (!table.IsDuckTable() || table.GetStorage().HasIndexes()) {
+		return false;
+	}
+	for (auto &constraint : table.GetConstraints()) {
+		if (constraint->type == ConstraintType::FOREIGN_KEY) {
+			return false;
+		}
+	}
+	return true;
+}
+
 BoundStatement Binder::Bind(InsertStatement &stmt) {
 	BoundStatement result;
 	result.names = {"Count"};
@@ -531,6 +546,9 @@ BoundStatement Binder::Bind(InsertStatement &stmt) {
 		// inserting into a non-temporary table: alters underlying database
 		auto &properties = GetStatementProperties();
 		properties.RegisterDBModify(table.catalog, context);
+		// appends only skip the checkpoint lock if background checkpoints can commit them into a rotated WAL
+		properties.append_only = DBConfig::GetConfig(context).options.background_checkpoint &&
+		                         !stmt.on_conflict_info && IsAppendOnlyTable(table);
 	}
 
 	auto insert = make_uniq<LogicalInsert>(table, GenerateTableIndex());
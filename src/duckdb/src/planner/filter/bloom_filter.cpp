@@ -0,0 +1,172 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/table_filter_state.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// BlockedBloomFilter
+//===--------------------------------------------------------------------===//
+static constexpr idx_t BLOOM_FILTER_BITS_PER_BLOCK = 256;
+
+//! Odd constants to derive the bit of each word from the hash, same as the Parquet split block Bloom filter
+static constexpr uint32_t BLOOM_FILTER_SALT[] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+BlockedBloomFilter::BlockedBloomFilter(idx_t expected_count, idx_t bits_per_key) {
+	auto bits = MaxValue<idx_t>(expected_count, 1) * bits_per_key;
+	auto block_count = NextPowerOfTwo((bits + BLOOM_FILTER_BITS_PER_BLOCK - 1) / BLOOM_FILTER_BITS_PER_BLOCK);
+	block_mask = block_count - 1;
+	words.resize(block_count * WORDS_PER_BLOCK, 0);
+}
+
+idx_t BlockedBloomFilter::BlockIndex(hash_t hash) const {
+	return (hash >> 32) & block_mask;
+}
+
+uint32_t BlockedBloomFilter::BitMask(hash_t hash, idx_t word_idx) {
+	auto key = static_cast<uint32_t>(hash);
+	return 1U << ((key * BLOOM_FILTER_SALT[word_idx]) >> 27);
+}
+
+void BlockedBloomFilter::Insert(hash_t hash) {
+	auto block = words.data() + BlockIndex(hash) * WORDS_PER_BLOCK;
+	for (idx_t word_idx = 0; word_idx < WORDS_PER_BLOCK; word_idx++) {
+		block[word_idx] |= BitMask(hash, word_idx);
+	}
+}
+
+bool BlockedBloomFilter::Lookup(hash_t hash) const {
+	auto block = words.data() + BlockIndex(hash) * WORDS_PER_BLOCK;
+	for (idx_t word_idx = 0; word_idx < WORDS_PER_BLOCK; word_idx++) {
+		auto mask = BitMask(hash, word_idx);
+		if ((block[word_idx] & mask) != mask) {
+			return false;
+		}
+	}
+	return true;
+}
+
+idx_t BlockedBloomFilter::SizeInBytes() const {
+	return words.size() * sizeof(uint32_t);
+}
+
+void BlockedBloomFilter::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty<idx_t>(100, "block_count", block_mask + 1);
+	serializer.WriteProperty(101, "words", const_data_ptr_cast(words.data()), SizeInBytes());
+}
+
+shared_ptr<BlockedBloomFilter> BlockedBloomFilter::Deserialize(Deserializer &deserializer) {
+	auto block_count = deserializer.ReadProperty<idx_t>(100, "block_count");
+	if (block_count == 0 || !IsPowerOfTwo(block_count)) {
+		throw SerializationException("Invalid block count %llu for Bloom filter", block_count);
+	}
+	auto result = make_shared_ptr<BlockedBloomFilter>(0);
+	result->block_mask = block_count - 1;
+	result->words.resize(block_count * WORDS_PER_BLOCK, 0);
+	deserializer.ReadProperty(101, "words", data_ptr_cast(result->words.data()), result->SizeInBytes());
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// BloomFilter
+//===--------------------------------------------------------------------===//
+BloomFilter::BloomFilter() : TableFilter(TableFilterType::BLOOM_FILTER) {
+}
+
+BloomFilter::BloomFilter(shared_ptr<BlockedBloomFilter> filter_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), filter(std::move(filter_p)) {
+}
+
+idx_t BloomFilter::Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t scan_count,
+                          idx_t approved_tuple_count, BloomFilterState &state) const {
+	if (!filter || state.disabled || approved_tuple_count == 0) {
+		return approved_tuple_count;
+	}
+	// hash only the rows that passed the previous filters
+	Vector hashes(LogicalType::HASH, scan_count);
+	VectorOperations::Hash(vector, hashes, sel, approved_tuple_count);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(scan_count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(idx))) {
+			// NULL never matches an equality join key
+			continue;
+		}
+		if (filter->Lookup(hash_data[hdata.sel->get_index(idx)])) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+
+	// stop evaluating a filter that (almost) does not filter anything for this scan
+	state.probed_count += approved_tuple_count;
+	state.passed_count += result_count;
+	if (state.probed_count >= SELECTIVITY_CHECK_COUNT &&
+	    static_cast<double>(state.passed_count) > MAX_PASS_RATIO * static_cast<double>(state.probed_count)) {
+		state.disabled = true;
+	}
+
+	sel.Initialize(result_sel);
+	return result_count;
+}
+
+bool BloomFilter::FilterValue(const Value &value) const {
+	if (!filter) {
+		return true;
+	}
+	if (value.IsNull()) {
+		return false;
+	}
+	Vector input(value);
+	Vector hashes(LogicalType::HASH, 1);
+	VectorOperations::Hash(input, hashes, 1);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(1, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	return filter->Lookup(hash_data[hdata.sel->get_index(0)]);
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) const {
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) const {
+	if (filter) {
+		return "Bloom Filter (" + column_name + ")";
+	} else {
+		return "Empty Bloom Filter (" + column_name + ")";
+	}
+}
+
+void BloomFilter::Serialize(Serializer &serializer) const {
+	// Bloom filters are only pushed into the scans of a physical plan at run-time
+	throw SerializationException("Cannot serialize Bloom filter");
+}
+
+unique_ptr<Expression> BloomFilter::ToExpression(const Expression &column) const {
+	// the filter only removes rows that are removed by the join anyway - it is safe to not evaluate it
+	return make_uniq<BoundConstantExpression>(Value(true));
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return other.filter.get() == filter.get();
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	return make_uniq<BloomFilter>(filter);
+}
+
+} // namespace duckdb
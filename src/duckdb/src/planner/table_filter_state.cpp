@@ -38,6 +38,8 @@ unique_ptr<TableFilterState> TableFilterState::Initialize(ClientContext &context
 		auto &expr_filter = filter.Cast<ExpressionFilter>();
 		return make_uniq<ExpressionFilterState>(context, *expr_filter.expr);
 	}
+	case TableFilterType::BLOOM_FILTER:
+		return make_uniq<BloomFilterState>();
 	case TableFilterType::CONSTANT_COMPARISON:
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
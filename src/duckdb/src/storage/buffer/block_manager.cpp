@@ -110,6 +110,12 @@ void BlockManager::Write(QueryContext context, FileBuffer &block, block_id_t blo
 	Write(block, block_id);
 }
 
+void BlockManager::ReadBlocksBatch(vector<BlockReadRequest> &requests) {
+	for (auto &request : requests) {
+		ReadBlocks(request.buffer.get(), request.start_block, request.block_count);
+	}
+}
+
 void BlockManager::Truncate() {
 }
 
@@ -0,0 +1,82 @@
+#include "duckdb/storage/buffer/block_read_ahead.hpp"
+
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/logging/logger.hpp"
+#include "duckdb/storage/buffer/block_handle.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+BlockReadAhead::BlockReadAhead(BufferManager &buffer_manager_p, idx_t thread_count)
+    : buffer_manager(buffer_manager_p) {
+#ifndef DUCKDB_NO_THREADS
+	for (idx_t i = 0; i < thread_count; i++) {
+		threads.emplace_back([this]() { WorkerLoop(); });
+	}
+#endif
+}
+
+BlockReadAhead::~BlockReadAhead() {
+	{
+		lock_guard<mutex> guard(lock);
+		shutdown = true;
+	}
+	cv.notify_all();
+	for (auto &worker : threads) {
+		worker.join();
+	}
+	// the remaining requests are dropped - their blocks are loaded when they are pinned
+	requests.clear();
+}
+
+bool BlockReadAhead::Schedule(vector<shared_ptr<BlockHandle>> handles, idx_t memory_budget) {
+	if (handles.empty() || threads.empty()) {
+		return false;
+	}
+	idx_t size = 0;
+	for (auto &handle : handles) {
+		size += handle->GetMemoryUsage();
+	}
+	{
+		lock_guard<mutex> guard(lock);
+		if (shutdown || scheduled_size + size > memory_budget) {
+			return false;
+		}
+		scheduled_size += size;
+		requests.push_back(ReadAheadRequest {std::move(handles), size});
+	}
+	cv.notify_one();
+	return true;
+}
+
+void BlockReadAhead::WorkerLoop() {
+	while (true) {
+		ReadAheadRequest request;
+		{
+			unique_lock<mutex> guard(lock);
+			cv.wait(guard, [&]() { return shutdown || !requests.empty(); });
+			if (shutdown) {
+				return;
+			}
+			request = std::move(requests.front());
+			requests.pop_front();
+		}
+		try {
+			// Prefetch batches adjacent blocks into a single read, and skips blocks that were loaded in the meantime
+			buffer_manager.Prefetch(request.handles);
+			DUCKDB_LOG_DEBUG(buffer_manager.GetDatabase(), "BlockReadAhead loaded %llu blocks (%llu bytes)",
+			                 request.handles.size(), request.size);
+		} catch (std::exception &ex) {
+			// read-ahead is best-effort (e.g. we might not be able to evict enough memory)
+			// the scan reports the error if it cannot load the block itself
+			ErrorData error(ex);
+			DUCKDB_LOG_DEBUG(buffer_manager.GetDatabase(), "BlockReadAhead failed: %s", error.RawMessage());
+		}
+		// release the handles before giving back the budget
+		request.handles.clear();
+		lock_guard<mutex> guard(lock);
+		scheduled_size -= request.size;
+	}
+}
+
+} // namespace duckdb
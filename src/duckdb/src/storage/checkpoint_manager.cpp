@@ -28,6 +28,7 @@
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/catalog/dependency_manager.hpp"
@@ -195,11 +196,10 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 	// WAL we write an entry CHECKPOINT "meta_block_id" into the WAL upon loading, if we see there is an entry
 	// CHECKPOINT "meta_block_id", and the id MATCHES the head idin the file we know that the database was successfully
 	// checkpointed, so we know that we should avoid replaying the WAL to avoid duplicating data
-	bool wal_is_empty = storage_manager.GetWALSize() == 0;
-	if (!wal_is_empty) {
-		auto wal = storage_manager.GetWAL();
-		wal->WriteCheckpoint(meta_block);
-		wal->Flush();
+	auto checkpoint_wals = storage_manager.GetCheckpointWALs();
+	for (auto &wal : checkpoint_wals) {
+		wal.get().WriteCheckpoint(meta_block);
+		wal.get().Flush();
 	}
 
 	if (config.options.checkpoint_abort == CheckpointAbort::DEBUG_ABORT_BEFORE_HEADER) {
@@ -249,7 +249,7 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 	block_manager.Truncate();
 
 	// truncate the WAL
-	if (!wal_is_empty) {
+	if (!checkpoint_wals.empty()) {
 		storage_manager.ResetWAL();
 	}
 }
@@ -537,13 +537,17 @@ void SingleFileCheckpointWriter::WriteTable(TableCatalogEntry &table, Serializer
 	serializer.WriteProperty(100, "table", &table);
 
 	// Write the table data
-	auto table_lock = table.GetStorage().GetCheckpointLock();
-	if (auto writer = GetTableDataWriter(table)) {
-		writer->WriteTableData(serializer);
+	{
+		auto table_lock = table.GetStorage().GetCheckpointLock();
+		if (auto writer = GetTableDataWriter(table)) {
+			writer->WriteTableData(serializer);
+		}
+		// flush any partial blocks BEFORE releasing the table lock
+		// flushing partial blocks updates where data lives and is not thread-safe
+		partial_block_manager.FlushPartialBlocks();
 	}
-	// flush any partial blocks BEFORE releasing the table lock
-	// flushing partial blocks updates where data lives and is not thread-safe
-	partial_block_manager.FlushPartialBlocks();
+	// commits that only append to this table no longer have to wait for a running background checkpoint
+	DuckTransactionManager::Get(db).OnTableCheckpointed(table.GetStorage());
 }
 
 void CheckpointReader::ReadTable(CatalogTransaction transaction, Deserializer &deserializer) {
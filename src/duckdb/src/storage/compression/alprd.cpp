@@ -15,18 +15,23 @@ CompressionFunction GetAlpRDFunction(PhysicalType data_type) {
 
 template <>
 CompressionFunction GetAlpRDFunction<float>(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_ALPRD, data_type, AlpRDInitAnalyze<float>,
-	                           AlpRDAnalyze<float>, AlpRDFinalAnalyze<float>, AlpRDInitCompression<float>,
-	                           AlpRDCompress<float>, AlpRDFinalizeCompress<float>, AlpRDInitScan<float>,
-	                           AlpRDScan<float>, AlpRDScanPartial<float>, AlpRDFetchRow<float>, AlpRDSkip<float>);
+	auto alprd = CompressionFunction(CompressionType::COMPRESSION_ALPRD, data_type, AlpRDInitAnalyze<float>,
+	                                 AlpRDAnalyze<float>, AlpRDFinalAnalyze<float>, AlpRDInitCompression<float>,
+	                                 AlpRDCompress<float>, AlpRDFinalizeCompress<float>, AlpRDInitScan<float>,
+	                                 AlpRDScan<float>, AlpRDScanPartial<float>, AlpRDFetchRow<float>, AlpRDSkip<float>);
+	alprd.filter = AlpRDFilter<float>;
+	return alprd;
 }
 
 template <>
 CompressionFunction GetAlpRDFunction<double>(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_ALPRD, data_type, AlpRDInitAnalyze<double>,
-	                           AlpRDAnalyze<double>, AlpRDFinalAnalyze<double>, AlpRDInitCompression<double>,
-	                           AlpRDCompress<double>, AlpRDFinalizeCompress<double>, AlpRDInitScan<double>,
-	                           AlpRDScan<double>, AlpRDScanPartial<double>, AlpRDFetchRow<double>, AlpRDSkip<double>);
+	auto alprd = CompressionFunction(CompressionType::COMPRESSION_ALPRD, data_type, AlpRDInitAnalyze<double>,
+	                                 AlpRDAnalyze<double>, AlpRDFinalAnalyze<double>, AlpRDInitCompression<double>,
+	                                 AlpRDCompress<double>, AlpRDFinalizeCompress<double>, AlpRDInitScan<double>,
+	                                 AlpRDScan<double>, AlpRDScanPartial<double>, AlpRDFetchRow<double>,
+	                                 AlpRDSkip<double>);
+	alprd.filter = AlpRDFilter<double>;
+	return alprd;
 }
 
 CompressionFunction AlpRDCompressionFun::GetFunction(PhysicalType type) {
@@ -11,6 +11,7 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/compression/bitpacking.hpp"
+#include "duckdb/storage/compression/range_filter.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -655,6 +656,9 @@ public:
 	data_ptr_t current_group_ptr;
 	data_ptr_t bitpacking_metadata_ptr;
 
+	//! Used to skip the groups that cannot pass a filter
+	unique_ptr<CompressedRangeFilter> range_filter;
+
 public:
 	//! Loads the metadata for the current metadata group. This will set bitpacking_metadata_ptr to the next group.
 	//! It also loads any metadata at the start of a compressed buffer (e.g. the width, for, or constant value)
@@ -778,6 +782,56 @@ public:
 	}
 };
 
+//! Determines the range of the next 'count' values of the current group from the group metadata
+template <class T, class T_U = typename MakeUnsigned<T>::type, bool IS_INTEGRAL = std::is_integral<T>::value>
+struct BitpackingValueRange {
+	static bool Get(const BitpackingScanState<T> &scan_state, idx_t count, T &min, T &max) {
+		switch (scan_state.current_group.mode) {
+		case BitpackingMode::CONSTANT:
+			min = scan_state.current_constant;
+			max = scan_state.current_constant;
+			return true;
+		case BitpackingMode::CONSTANT_DELTA: {
+			// the values are monotonic, so the range is given by the first and last value
+			auto first = GetConstantDeltaValue(scan_state, scan_state.current_group_offset);
+			auto last = GetConstantDeltaValue(scan_state, scan_state.current_group_offset + count - 1);
+			min = MinValue(first, last);
+			max = MaxValue(first, last);
+			return true;
+		}
+		case BitpackingMode::FOR: {
+			// the values are the frame of reference plus an offset of 'width' bits
+			const auto width = scan_state.current_width;
+			const T_U max_offset = width >= sizeof(T) * 8 ? NumericLimits<T_U>::Maximum()
+			                                              : static_cast<T_U>((static_cast<T_U>(1) << width) - 1);
+			const auto headroom = static_cast<T_U>(static_cast<T_U>(NumericLimits<T>::Maximum()) -
+			                                       static_cast<T_U>(scan_state.current_frame_of_reference));
+			min = scan_state.current_frame_of_reference;
+			max = max_offset >= headroom
+			          ? NumericLimits<T>::Maximum()
+			          : static_cast<T>(static_cast<T_U>(scan_state.current_frame_of_reference) + max_offset);
+			return true;
+		}
+		default:
+			// DELTA_FOR: the range depends on all previous values
+			return false;
+		}
+	}
+
+	static T GetConstantDeltaValue(const BitpackingScanState<T> &scan_state, idx_t multiplier) {
+		// intended static casts to unsigned and back for defined wrapping of integers
+		return static_cast<T>((static_cast<T_U>(scan_state.current_constant) * multiplier) +
+		                      static_cast<T_U>(scan_state.current_frame_of_reference));
+	}
+};
+
+template <class T, class T_U>
+struct BitpackingValueRange<T, T_U, false> {
+	static bool Get(const BitpackingScanState<T> &scan_state, idx_t count, T &min, T &max) {
+		return false;
+	}
+};
+
 template <class T>
 unique_ptr<SegmentScanState> BitpackingInitScan(ColumnSegment &segment) {
 	auto result = make_uniq<BitpackingScanState<T>>(segment);
@@ -883,6 +937,59 @@ void BitpackingScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_c
 	BitpackingScanPartial<T>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+void BitpackingFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+                      SelectionVector &sel, idx_t &sel_count, const TableFilter &filter,
+                      TableFilterState &filter_state) {
+	auto &scan_state = state.scan_state->Cast<BitpackingScanState<T>>();
+	if (!CompressedRangeFilter::Supports<T>(result.GetType(), filter)) {
+		// fallback: scan + filter
+		BitpackingScan<T>(segment, state, vector_count, result);
+		UnifiedVectorFormat vdata;
+		result.ToUnifiedFormat(vector_count, vdata);
+		ColumnSegment::FilterSelection(sel, result, vdata, filter, filter_state, vector_count, sel_count);
+		return;
+	}
+	if (!scan_state.range_filter) {
+		scan_state.range_filter = make_uniq<CompressedRangeFilter>(result.GetType());
+	}
+	CompressedRangeFilter &range_filter = *scan_state.range_filter;
+	range_filter.Reset();
+
+	// check the value range of each group against the filter, groups in which no value can pass are not decoded
+	idx_t scanned = 0;
+	while (scanned < vector_count) {
+		if (scan_state.current_group_offset == BITPACKING_METADATA_GROUP_SIZE) {
+			scan_state.LoadNextGroup();
+		}
+		const auto to_scan =
+		    MinValue<idx_t>(vector_count - scanned, BITPACKING_METADATA_GROUP_SIZE - scan_state.current_group_offset);
+
+		T min;
+		T max;
+		FilterPropagateResult group_result;
+		if (BitpackingValueRange<T>::Get(scan_state, to_scan, min, max)) {
+			group_result = range_filter.CheckRange<T>(filter, scanned, scanned + to_scan, min, max);
+		} else {
+			group_result = range_filter.AddRange(scanned, scanned + to_scan);
+		}
+
+		if (group_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			// only groups with a known range are pruned, these can be skipped by moving the offset
+			D_ASSERT(scan_state.current_group.mode != BitpackingMode::DELTA_FOR);
+			scan_state.current_group_offset += to_scan;
+		} else {
+			BitpackingScanPartial<T>(segment, state, to_scan, result, scanned);
+		}
+		scanned += to_scan;
+	}
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	range_filter.Apply(result, vector_count, sel, sel_count, filter, filter_state);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -984,6 +1091,7 @@ CompressionFunction GetBitpackingFunction(PhysicalType data_type) {
 	    BitpackingCompress<T, WRITE_STATISTICS>, BitpackingFinalizeCompress<T, WRITE_STATISTICS>, BitpackingInitScan<T>,
 	    BitpackingScan<T>, BitpackingScanPartial<T>, BitpackingFetchRow<T>, BitpackingSkip<T>);
 	bitpacking.get_segment_info = BitpackingGetSegmentInfo<T>;
+	bitpacking.filter = BitpackingFilter<T>;
 	return bitpacking;
 }
 
@@ -62,6 +62,9 @@ struct DictionaryCompressionStorage {
 	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
 	                              idx_t result_offset);
 	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+	                         SelectionVector &sel, idx_t &sel_count, const TableFilter &filter,
+	                         TableFilterState &filter_state);
 	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
 	                           idx_t result_idx);
 };
@@ -147,6 +150,58 @@ void DictionaryCompressionStorage::StringScan(ColumnSegment &segment, ColumnScan
 	StringScanPartial<true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+void DictionaryCompressionStorage::StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count,
+                                                Vector &result, SelectionVector &sel, idx_t &sel_count,
+                                                const TableFilter &filter, TableFilterState &filter_state) {
+	auto &scan_state = state.scan_state->Cast<CompressedStringScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+	if (vector_count == STANDARD_VECTOR_SIZE && scan_state.dictionary) {
+		// evaluate the filter on the dictionary entries instead of on every row
+		if (!scan_state.filter_result) {
+			scan_state.filter_result = make_unsafe_uniq_array<bool>(scan_state.dictionary_size);
+			for (idx_t i = 0; i < scan_state.dictionary_size; i++) {
+				scan_state.filter_result[i] = false;
+			}
+
+			UnifiedVectorFormat vdata;
+			scan_state.dictionary->ToUnifiedFormat(scan_state.dictionary_size, vdata);
+			SelectionVector dict_sel;
+			idx_t filter_count = scan_state.dictionary_size;
+			ColumnSegment::FilterSelection(dict_sel, *scan_state.dictionary, vdata, filter, filter_state,
+			                               scan_state.dictionary_size, filter_count);
+			for (idx_t i = 0; i < filter_count; i++) {
+				scan_state.filter_result[dict_sel.get_index(i)] = true;
+			}
+		}
+		// emit a dictionary vector and look up the filter result of the index of every selected row
+		scan_state.ScanToDictionaryVector(segment, result, 0, start, vector_count);
+		auto &dict_sel = *scan_state.sel_vec;
+		SelectionVector new_sel(sel_count);
+		idx_t approved_tuple_count = 0;
+		for (idx_t idx = 0; idx < sel_count; idx++) {
+			auto row_idx = sel.get_index(idx);
+			if (!scan_state.filter_result[dict_sel.get_index(row_idx)]) {
+				continue;
+			}
+			new_sel.set_index(approved_tuple_count++, row_idx);
+		}
+		if (approved_tuple_count < vector_count) {
+			sel.Initialize(new_sel);
+		}
+		sel_count = approved_tuple_count;
+		return;
+	}
+	// fallback: scan + filter
+	StringScan(segment, state, vector_count, result);
+
+	UnifiedVectorFormat vdata;
+	result.ToUnifiedFormat(vector_count, vdata);
+	ColumnSegment::FilterSelection(sel, result, vdata, filter, filter_state, vector_count, sel_count);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -162,7 +217,7 @@ void DictionaryCompressionStorage::StringFetchRow(ColumnSegment &segment, Column
 // Get Function
 //===--------------------------------------------------------------------===//
 CompressionFunction DictionaryCompressionFun::GetFunction(PhysicalType data_type) {
-	return CompressionFunction(
+	auto res = CompressionFunction(
 	    CompressionType::COMPRESSION_DICTIONARY, data_type, DictionaryCompressionStorage ::StringInitAnalyze,
 	    DictionaryCompressionStorage::StringAnalyze, DictionaryCompressionStorage::StringFinalAnalyze,
 	    DictionaryCompressionStorage::InitCompression, DictionaryCompressionStorage::Compress,
@@ -170,6 +225,8 @@ CompressionFunction DictionaryCompressionFun::GetFunction(PhysicalType data_type
 	    DictionaryCompressionStorage::StringScan, DictionaryCompressionStorage::StringScanPartial<false>,
 	    DictionaryCompressionStorage::StringFetchRow, UncompressedFunctions::EmptySkip,
 	    UncompressedStringStorage::StringInitSegment);
+	res.filter = DictionaryCompressionStorage::StringFilter;
+	return res;
 }
 
 bool DictionaryCompressionFun::TypeIsSupported(const PhysicalType physical_type) {
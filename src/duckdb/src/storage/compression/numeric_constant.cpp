@@ -150,6 +150,7 @@ void FiltersNullValues(const LogicalType &type, const TableFilter &filter, bool
 		filters_valid_values = true;
 		break;
 	case TableFilterType::IS_NOT_NULL:
+	case TableFilterType::BLOOM_FILTER:
 		filters_nulls = true;
 		break;
 	case TableFilterType::EXPRESSION_FILTER: {
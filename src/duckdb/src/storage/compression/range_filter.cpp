@@ -0,0 +1,121 @@
+#include "duckdb/storage/compression/range_filter.hpp"
+
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/optional_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+
+namespace duckdb {
+
+CompressedRangeFilter::CompressedRangeFilter(const LogicalType &type) : stats(NumericStats::CreateUnknown(type)) {
+}
+
+static bool SupportsFilters(const LogicalType &type, const vector<unique_ptr<TableFilter>> &filters) {
+	for (auto &filter : filters) {
+		if (!CompressedRangeFilter::SupportsFilter(type, *filter)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool CompressedRangeFilter::SupportsFilter(const LogicalType &type, const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return BaseStatistics::GetStatsType(type) == StatisticsType::NUMERIC_STATS;
+	case TableFilterType::CONJUNCTION_AND:
+		return SupportsFilters(type, filter.Cast<ConjunctionAndFilter>().child_filters);
+	case TableFilterType::CONJUNCTION_OR:
+		return SupportsFilters(type, filter.Cast<ConjunctionOrFilter>().child_filters);
+	case TableFilterType::OPTIONAL_FILTER: {
+		auto &optional_filter = filter.Cast<OptionalFilter>();
+		return optional_filter.child_filter && SupportsFilter(type, *optional_filter.child_filter);
+	}
+	default:
+		return false;
+	}
+}
+
+FilterPropagateResult CompressedRangeFilter::CheckStatistics(const TableFilter &filter) {
+	switch (filter.CheckStatistics(stats)) {
+	case FilterPropagateResult::FILTER_ALWAYS_TRUE:
+		return FilterPropagateResult::FILTER_ALWAYS_TRUE;
+	case FilterPropagateResult::FILTER_ALWAYS_FALSE:
+	case FilterPropagateResult::FILTER_FALSE_OR_NULL:
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
+FilterPropagateResult CompressedRangeFilter::AddRange(idx_t start, idx_t end, FilterPropagateResult result) {
+	D_ASSERT(ranges.empty() ? start == 0 : ranges.back().end == start);
+	ranges.push_back({start, end, result});
+	return result;
+}
+
+void CompressedRangeFilter::Apply(Vector &result, idx_t vector_count, SelectionVector &sel, idx_t &sel_count,
+                                  const TableFilter &filter, TableFilterState &filter_state) const {
+	D_ASSERT(!ranges.empty() && ranges.back().end == vector_count);
+	bool pruned_any = false;
+	for (auto &range : ranges) {
+		pruned_any = pruned_any || range.result != FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	UnifiedVectorFormat vdata;
+	if (!pruned_any) {
+		result.ToUnifiedFormat(vector_count, vdata);
+		ColumnSegment::FilterSelection(sel, result, vdata, filter, filter_state, vector_count, sel_count);
+		return;
+	}
+
+	// look up the result of the range of every selected row, the rows are usually ordered
+	vector<FilterPropagateResult> row_results(sel_count);
+	idx_t range_idx = 0;
+	for (idx_t i = 0; i < sel_count; i++) {
+		const auto row_idx = sel.get_index(i);
+		if (row_idx < ranges[range_idx].start) {
+			range_idx = 0;
+		}
+		while (row_idx >= ranges[range_idx].end) {
+			range_idx++;
+		}
+		row_results[i] = ranges[range_idx].result;
+	}
+
+	// only compare the rows of the ranges that could not be pruned
+	SelectionVector compare_sel(sel_count);
+	idx_t compare_count = 0;
+	for (idx_t i = 0; i < sel_count; i++) {
+		if (row_results[i] == FilterPropagateResult::NO_PRUNING_POSSIBLE) {
+			compare_sel.set_index(compare_count++, sel.get_index(i));
+		}
+	}
+	bool compare_passes[STANDARD_VECTOR_SIZE];
+	if (compare_count > 0) {
+		for (idx_t i = 0; i < compare_count; i++) {
+			compare_passes[compare_sel.get_index(i)] = false;
+		}
+		result.ToUnifiedFormat(vector_count, vdata);
+		ColumnSegment::FilterSelection(compare_sel, result, vdata, filter, filter_state, vector_count, compare_count);
+		for (idx_t i = 0; i < compare_count; i++) {
+			compare_passes[compare_sel.get_index(i)] = true;
+		}
+	}
+
+	SelectionVector new_sel(sel_count);
+	idx_t approved_tuple_count = 0;
+	for (idx_t i = 0; i < sel_count; i++) {
+		const auto row_idx = sel.get_index(i);
+		if (row_results[i] == FilterPropagateResult::FILTER_ALWAYS_TRUE ||
+		    (row_results[i] == FilterPropagateResult::NO_PRUNING_POSSIBLE && compare_passes[row_idx])) {
+			new_sel.set_index(approved_tuple_count++, row_idx);
+		}
+	}
+	if (approved_tuple_count < vector_count) {
+		sel.Initialize(new_sel);
+	}
+	sel_count = approved_tuple_count;
+}
+
+} // namespace duckdb
@@ -160,6 +160,20 @@ DataTable::DataTable(ClientContext &context, DataTable &parent, BoundConstraint
 	parent.version = DataTableVersion::ALTERED;
 }
 
+DataTable::DataTable(ClientContext &context, DataTable &parent, idx_t changed_idx, bool bloom_filter)
+    : db(parent.db), info(parent.info), row_groups(parent.row_groups), version(DataTableVersion::MAIN_TABLE) {
+	// ALTER COLUMN to declare or drop a Bloom filter: the data is unchanged, only the column definitions are.
+	auto &local_storage = LocalStorage::Get(context, db);
+	lock_guard<mutex> parent_lock(parent.append_lock);
+	for (auto &column_def : parent.column_definitions) {
+		column_definitions.emplace_back(column_def.Copy());
+	}
+	column_definitions[changed_idx].SetBloomFilter(bloom_filter);
+
+	local_storage.MoveStorage(parent, *this);
+	parent.version = DataTableVersion::ALTERED;
+}
+
 DataTable::DataTable(ClientContext &context, DataTable &parent, idx_t changed_idx, const LogicalType &target_type,
                      const vector<StorageIndex> &bound_columns, Expression &cast_expr)
     : db(parent.db), info(parent.info), version(DataTableVersion::MAIN_TABLE) {
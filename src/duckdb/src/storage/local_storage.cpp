@@ -302,6 +302,15 @@ shared_ptr<LocalTableStorage> LocalTableManager::MoveEntry(DataTable &table) {
 	return storage_entry;
 }
 
+vector<reference<DataTable>> LocalTableManager::GetTables() const {
+	lock_guard<mutex> l(table_storage_lock);
+	vector<reference<DataTable>> tables;
+	for (auto &entry : table_storage) {
+		tables.push_back(entry.first);
+	}
+	return tables;
+}
+
 reference_map_t<DataTable, shared_ptr<LocalTableStorage>> LocalTableManager::MoveEntries() {
 	lock_guard<mutex> l(table_storage_lock);
 	return std::move(table_storage);
@@ -477,6 +486,10 @@ bool LocalStorage::Find(DataTable &table) {
 	return table_manager.GetStorage(table) != nullptr;
 }
 
+vector<reference<DataTable>> LocalStorage::GetTables() const {
+	return table_manager.GetTables();
+}
+
 idx_t LocalStorage::EstimatedSize() {
 	return table_manager.EstimatedSize();
 }
@@ -587,6 +600,15 @@ idx_t LocalStorage::AddedRows(DataTable &table) {
 	return storage->row_groups->GetTotalRows() - storage->deleted_rows;
 }
 
+bool LocalStorage::WritesRowGroupsOnCommit(DataTable &table) {
+	auto storage = table_manager.GetStorage(table);
+	if (!storage) {
+		return false;
+	}
+	// see LocalTableStorage::FlushBlocks
+	return storage->row_groups->GetTotalRows() > storage->row_groups->GetRowGroupSize();
+}
+
 vector<PartitionStatistics> LocalStorage::GetPartitionStats(DataTable &table) const {
 	auto storage = table_manager.GetStorage(table);
 	if (!storage) {
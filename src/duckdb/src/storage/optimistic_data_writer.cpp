@@ -2,6 +2,7 @@
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/partial_block_manager.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
 
 namespace duckdb {
 
@@ -24,6 +25,8 @@ bool OptimisticDataWriter::PrepareWrite() {
 		return false;
 	}
 	// we should! write the second-to-last row group to disk
+	// transactions that only append obtain the checkpoint lock here - a checkpoint cannot run while blocks are written
+	DuckTransaction::Get(context, table.GetAttached()).AcquireCheckpointLock();
 	// allocate the partial block-manager if none is allocated yet
 	if (!partial_manager) {
 		auto &block_manager = table.GetTableIOManager().GetBlockManagerForRowData();
@@ -60,10 +63,13 @@ void OptimisticDataWriter::FlushToDisk(RowGroup &row_group) {
 	//! The set of column compression types (if any)
 	vector<CompressionType> compression_types;
 	D_ASSERT(compression_types.empty());
+	//! Whether to build a Bloom filter for each of the columns
+	vector<bool> bloom_filters;
 	for (auto &column : table.Columns()) {
 		compression_types.push_back(column.CompressionType());
+		bloom_filters.push_back(column.HasBloomFilter());
 	}
-	RowGroupWriteInfo info(*partial_manager, compression_types);
+	RowGroupWriteInfo info(*partial_manager, compression_types, bloom_filters);
 	row_group.WriteToDisk(info);
 }
 
@@ -160,6 +160,9 @@ unique_ptr<AlterInfo> AlterTableInfo::Deserialize(Deserializer &deserializer) {
 	case AlterTableType::RENAME_TABLE:
 		result = RenameTableInfo::Deserialize(deserializer);
 		break;
+	case AlterTableType::SET_BLOOM_FILTER:
+		result = SetBloomFilterInfo::Deserialize(deserializer);
+		break;
 	case AlterTableType::SET_DEFAULT:
 		result = SetDefaultInfo::Deserialize(deserializer);
 		break;
@@ -517,6 +520,19 @@ unique_ptr<AlterViewInfo> RenameViewInfo::Deserialize(Deserializer &deserializer
 	return std::move(result);
 }
 
+void SetBloomFilterInfo::Serialize(Serializer &serializer) const {
+	AlterTableInfo::Serialize(serializer);
+	serializer.WritePropertyWithDefault<string>(400, "column_name", column_name);
+	serializer.WritePropertyWithDefault<bool>(401, "bloom_filter", bloom_filter);
+}
+
+unique_ptr<AlterTableInfo> SetBloomFilterInfo::Deserialize(Deserializer &deserializer) {
+	auto result = duckdb::unique_ptr<SetBloomFilterInfo>(new SetBloomFilterInfo());
+	deserializer.ReadPropertyWithDefault<string>(400, "column_name", result->column_name);
+	deserializer.ReadPropertyWithDefault<bool>(401, "bloom_filter", result->bloom_filter);
+	return std::move(result);
+}
+
 void SetColumnCommentInfo::Serialize(Serializer &serializer) const {
 	AlterInfo::Serialize(serializer);
 	serializer.WriteProperty<CatalogType>(300, "catalog_entry_type", catalog_entry_type);
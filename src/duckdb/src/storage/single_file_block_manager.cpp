@@ -8,6 +8,7 @@
 #include "duckdb/common/encryption_state.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/logging/logger.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
@@ -244,6 +245,11 @@ SingleFileBlockManager::SingleFileBlockManager(AttachedDatabase &db_p, const str
       iteration_count(0), options(options) {
 }
 
+SingleFileBlockManager::~SingleFileBlockManager() {
+	// stop the read-ahead threads before the file handle is closed, as they might still be reading blocks
+	read_ahead.reset();
+}
+
 FileOpenFlags SingleFileBlockManager::GetFileFlags(bool create_new) const {
 	FileOpenFlags result;
 	if (options.read_only) {
@@ -823,6 +829,21 @@ bool SingleFileBlockManager::IsRemote() {
 	return !handle->OnDiskFile();
 }
 
+void SingleFileBlockManager::ReadAhead(vector<shared_ptr<BlockHandle>> &handles) {
+	auto &config = DBConfig::GetConfig(db.GetDatabase());
+	auto thread_count = config.options.read_ahead_threads;
+	if (thread_count == 0 || handles.empty()) {
+		return;
+	}
+	lock_guard<mutex> lock(read_ahead_lock);
+	if (!read_ahead) {
+		// the thread count is fixed once the first scan has used read-ahead
+		read_ahead = make_uniq<BlockReadAhead>(buffer_manager, thread_count);
+	}
+	// limit the blocks that are being loaded ahead of the scans to a fraction of the memory limit
+	read_ahead->Schedule(std::move(handles), buffer_manager.GetMaxMemory() / READ_AHEAD_MEMORY_FRACTION);
+}
+
 unique_ptr<Block> SingleFileBlockManager::ConvertBlock(block_id_t block_id, FileBuffer &source_buffer) {
 	D_ASSERT(source_buffer.AllocSize() == GetBlockAllocSize());
 	// FIXME; maybe we should pass the block header size explicitly
@@ -895,6 +916,34 @@ void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_blo
 	}
 }
 
+void SingleFileBlockManager::ReadBlocksBatch(vector<BlockReadRequest> &requests) {
+	// read all ranges from disk at once
+	vector<FileIORequest> io_requests;
+	io_requests.reserve(requests.size());
+	for (auto &request : requests) {
+		D_ASSERT(request.start_block >= 0);
+		D_ASSERT(request.block_count >= 1);
+		auto &buffer = request.buffer.get();
+		io_requests.push_back(
+		    FileIORequest {buffer.InternalBuffer(), buffer.AllocSize(), GetBlockLocation(request.start_block)});
+	}
+	handle->ReadBatch(io_requests);
+	DUCKDB_LOG_DEBUG(db.GetDatabase(), "SingleFileBlockManager read %llu block ranges in one batch", requests.size());
+
+	// for each of the blocks - verify the checksum
+	for (auto &request : requests) {
+		auto ptr = request.buffer.get().InternalBuffer();
+		for (idx_t i = 0; i < request.block_count; i++) {
+			auto start_ptr = ptr + i * GetBlockAllocSize();
+			ReadBlock(start_ptr, GetBlockSize());
+		}
+	}
+}
+
+bool SingleFileBlockManager::SupportsConcurrentBlockReads() {
+	return handle->file_system.SupportsConcurrentBatchRead(*handle);
+}
+
 void SingleFileBlockManager::Write(FileBuffer &buffer, block_id_t block_id) {
 	Write(QueryContext(), buffer, block_id);
 }
@@ -263,6 +263,46 @@ void StandardBufferManager::BatchRead(vector<shared_ptr<BlockHandle>> &handles,
 	// perform a batch read of the blocks into the buffer
 	block_manager.ReadBlocks(intermediate_buffer.GetFileBuffer(), first_block, block_count);
 
+	LoadBatch(handles, load_map, first_block, block_count, intermediate_buffer);
+}
+
+void StandardBufferManager::BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
+                                      const vector<pair<block_id_t, block_id_t>> &ranges) {
+	auto &block_manager = handles[0]->block_manager;
+	idx_t range_idx = 0;
+	while (range_idx < ranges.size()) {
+		// gather ranges until we reach the maximum amount of blocks that we read in one go
+		vector<BufferHandle> intermediate_buffers;
+		vector<BlockReadRequest> requests;
+		idx_t batch_start = range_idx;
+		idx_t batch_block_count = 0;
+		for (; range_idx < ranges.size(); range_idx++) {
+			auto first_block = ranges[range_idx].first;
+			auto block_count = NumericCast<idx_t>(ranges[range_idx].second - first_block + 1);
+			if (!requests.empty() && batch_block_count + block_count > MAX_BATCH_READ_BLOCKS) {
+				break;
+			}
+			batch_block_count += block_count;
+
+			auto total_block_size = block_count * block_manager.GetBlockAllocSize();
+			auto batch_memory = RegisterMemory(MemoryTag::BASE_TABLE, total_block_size, 0, true);
+			intermediate_buffers.push_back(Pin(batch_memory));
+			requests.emplace_back(intermediate_buffers.back().GetFileBuffer(), first_block, block_count);
+		}
+
+		// read all ranges at once
+		block_manager.ReadBlocksBatch(requests);
+
+		for (idx_t i = 0; i < requests.size(); i++) {
+			LoadBatch(handles, load_map, requests[i].start_block, requests[i].block_count, intermediate_buffers[i]);
+		}
+		D_ASSERT(batch_start + requests.size() == range_idx);
+	}
+}
+
+void StandardBufferManager::LoadBatch(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
+                                      block_id_t first_block, idx_t block_count, BufferHandle &intermediate_buffer) {
+	auto &block_manager = handles[0]->block_manager;
 	// the blocks are read - now we need to assign them to the individual blocks
 	for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
 		block_id_t block_id = first_block + NumericCast<block_id_t>(block_idx);
@@ -308,7 +348,8 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 		// nothing to fetch
 		return;
 	}
-	// iterate over the blocks and perform bulk reads
+	// iterate over the blocks and gather the ranges of adjacent blocks
+	vector<pair<block_id_t, block_id_t>> ranges;
 	block_id_t first_block = -1;
 	block_id_t previous_block_id = -1;
 	for (auto &entry : to_be_loaded) {
@@ -320,17 +361,26 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 			// this block is adjacent to the previous block - add it to the batch read
 			previous_block_id = entry.first;
 		} else {
-			// this block is not adjacent to the previous block
-			// perform the batch read for the previous batch
-			BatchRead(handles, to_be_loaded, first_block, previous_block_id);
+			// this block is not adjacent to the previous block - finish the previous range
+			ranges.emplace_back(first_block, previous_block_id);
 
 			// set the first_block and previous_block_id to the current block
 			first_block = entry.first;
 			previous_block_id = entry.first;
 		}
 	}
-	// batch read the final batch
-	BatchRead(handles, to_be_loaded, first_block, previous_block_id);
+	ranges.emplace_back(first_block, previous_block_id);
+
+	auto &block_manager = handles[0]->block_manager;
+	if (ranges.size() > 1 && block_manager.SupportsConcurrentBlockReads()) {
+		// the block manager can read all ranges (including single blocks) at the same time
+		BatchRead(handles, to_be_loaded, ranges);
+		return;
+	}
+	// perform a bulk read for each of the ranges
+	for (auto &range : ranges) {
+		BatchRead(handles, to_be_loaded, range.first, range.second);
+	}
 }
 
 BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
@@ -16,6 +16,9 @@
 
 namespace duckdb {
 
+//! Suffix of the WAL that commits are written to while a background checkpoint writes the regular WAL
+static constexpr const char *NEXT_WAL_SUFFIX = ".wal.next";
+
 using SHA256State = duckdb_mbedtls::MbedTlsWrapper::SHA256State;
 
 StorageManager::StorageManager(AttachedDatabase &db, string path_p, bool read_only)
@@ -48,7 +51,12 @@ ObjectCache &ObjectCache::GetObjectCache(ClientContext &context) {
 }
 
 idx_t StorageManager::GetWALSize() {
-	return wal->GetWALSize();
+	auto wal_size = wal->GetWALSize();
+	if (rotated_wal && !checkpointing_rotated_wal) {
+		// the rotated WAL still has to be replayed as well
+		wal_size += rotated_wal->GetWALSize();
+	}
+	return wal_size;
 }
 
 optional_ptr<WriteAheadLog> StorageManager::GetWAL() {
@@ -59,10 +67,52 @@ optional_ptr<WriteAheadLog> StorageManager::GetWAL() {
 }
 
 void StorageManager::ResetWAL() {
+	if (rotated_wal) {
+		rotated_wal->Delete();
+		rotated_wal.reset();
+		if (checkpointing_rotated_wal) {
+			// the commits written to the WAL while the checkpoint was running are not part of the checkpoint
+			return;
+		}
+		// the checkpoint covered both WALs - continue with a fresh WAL at the regular path
+		wal->Delete();
+		wal = make_uniq<WriteAheadLog>(db, GetWALPath());
+		return;
+	}
 	wal->Delete();
 }
 
-string StorageManager::GetWALPath() {
+bool StorageManager::RotateWAL() {
+	if (rotated_wal || wal->GetWALSize() == 0) {
+		return false;
+	}
+	rotated_wal = std::move(wal);
+	wal = make_uniq<WriteAheadLog>(db, GetWALPath(NEXT_WAL_SUFFIX));
+	checkpointing_rotated_wal = true;
+	return true;
+}
+
+void StorageManager::EndWALRotation() {
+	checkpointing_rotated_wal = false;
+	if (rotated_wal) {
+		// the checkpoint did not finish - both WALs are replayed on restart, and the next checkpoint covers both
+		return;
+	}
+	wal->Move(GetWALPath());
+}
+
+vector<reference<WriteAheadLog>> StorageManager::GetCheckpointWALs() {
+	vector<reference<WriteAheadLog>> result;
+	if (rotated_wal && rotated_wal->GetWALSize() > 0) {
+		result.push_back(*rotated_wal);
+	}
+	if (!checkpointing_rotated_wal && wal->GetWALSize() > 0) {
+		result.push_back(*wal);
+	}
+	return result;
+}
+
+string StorageManager::GetWALPath(const string &suffix) {
 	// we append the ".wal" **before** a question mark in case of GET parameters
 	// but only if we are not in a windows long path (which starts with \\?\)
 	std::size_t question_mark_pos = std::string::npos;
@@ -71,9 +121,9 @@ string StorageManager::GetWALPath() {
 	}
 	auto wal_path = path;
 	if (question_mark_pos != std::string::npos) {
-		wal_path.insert(question_mark_pos, ".wal");
+		wal_path.insert(question_mark_pos, suffix);
 	} else {
-		wal_path += ".wal";
+		wal_path += suffix;
 	}
 	return wal_path;
 }
@@ -171,8 +221,9 @@ void SingleFileStorageManager::LoadDatabase(QueryContext context, StorageOptions
 		// create a new file
 
 		auto wal_path = GetWALPath();
-		// try to remove the WAL file if it exists
+		// try to remove the WAL files if they exist
 		fs.TryRemoveFile(wal_path);
+		fs.TryRemoveFile(GetWALPath(NEXT_WAL_SUFFIX));
 
 		// Set the block allocation size for the new database file.
 		if (storage_options.block_alloc_size.IsValid()) {
@@ -259,6 +310,19 @@ void SingleFileStorageManager::LoadDatabase(QueryContext context, StorageOptions
 
 		auto wal_path = GetWALPath();
 		wal = WriteAheadLog::Replay(fs, db, wal_path);
+
+		// commits made while a background checkpoint was running are in a second WAL, which is replayed after
+		auto next_wal_path = GetWALPath(NEXT_WAL_SUFFIX);
+		if (fs.FileExists(next_wal_path)) {
+			auto next_wal = WriteAheadLog::Replay(fs, db, next_wal_path);
+			if (wal->GetWALSize() > 0) {
+				// the checkpoint did not finish: keep both WALs until the next checkpoint
+				rotated_wal = std::move(wal);
+			} else if (!read_only) {
+				next_wal->Move(wal_path);
+			}
+			wal = std::move(next_wal);
+		}
 	}
 	if (row_group_size > 122880ULL && GetStorageVersion() < 4) {
 		throw InvalidInputException("Unsupported row group size %llu - row group sizes >= 122_880 are only supported "
@@ -309,7 +373,7 @@ private:
 
 SingleFileStorageCommitState::SingleFileStorageCommitState(StorageManager &storage, WriteAheadLog &wal)
     : wal(wal), state(WALCommitState::IN_PROGRESS) {
-	auto initial_size = storage.GetWALSize();
+	auto initial_size = wal.GetWALSize();
 	initial_written = wal.GetTotalWritten();
 	initial_wal_size = initial_size;
 }
@@ -197,6 +197,7 @@ void ColumnCheckpointState::FlushSegmentInternal(unique_ptr<ColumnSegment> segme
 PersistentColumnData ColumnCheckpointState::ToPersistentData() {
 	PersistentColumnData data(column_data.type.InternalType());
 	data.pointers = std::move(data_pointers);
+	data.bloom_filter = column_data.GetBloomFilter();
 	return data;
 }
 
@@ -2,6 +2,11 @@
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/function/compression_function.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
+#include "duckdb/planner/filter/optional_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -94,6 +99,8 @@ void ColumnData::InitializeScan(ColumnScanState &state) {
 	state.initialized = false;
 	state.scan_state.reset();
 	state.last_offset = 0;
+	state.vector_stats.reset();
+	state.vector_stats_loaded = false;
 }
 
 void ColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx) {
@@ -104,6 +111,8 @@ void ColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx)
 	state.initialized = false;
 	state.scan_state.reset();
 	state.last_offset = 0;
+	state.vector_stats.reset();
+	state.vector_stats_loaded = false;
 }
 
 ScanVectorType ColumnData::GetVectorScanType(ColumnScanState &state, idx_t scan_count, Vector &result) {
@@ -424,6 +433,274 @@ FilterPropagateResult ColumnData::CheckZonemap(TableFilter &filter) {
 	return filter.CheckStatistics(stats->statistics);
 }
 
+FilterPropagateResult ColumnData::CheckVectorZonemap(ColumnScanState &state, idx_t vector_index,
+                                                     TableFilter &filter) {
+	if (!state.vector_stats_loaded) {
+		state.vector_stats = LoadVectorStatistics();
+		state.vector_stats_loaded = true;
+	}
+	if (!state.vector_stats || vector_index >= state.vector_stats->size()) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	// CheckStatistics does not modify the statistics, it just lacks the const qualifier
+	auto &zone = const_cast<BaseStatistics &>((*state.vector_stats)[vector_index]);
+	auto prune_result = filter.CheckStatistics(zone);
+	if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+		// we only use the vector statistics to skip vectors
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	lock_guard<mutex> l(update_lock);
+	if (!updates) {
+		return prune_result;
+	}
+	// the updated values could pass the filter
+	auto update_stats = updates->GetStatistics();
+	if (filter.CheckStatistics(*update_stats) != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return prune_result;
+}
+
+bool ColumnData::SupportsBloomFilter(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+		return true;
+	case PhysicalType::VARCHAR:
+		// collated strings can be equal without having the same bytes
+		return type.id() != LogicalTypeId::VARCHAR || StringType::GetCollation(type).empty();
+	default:
+		return false;
+	}
+}
+
+//! Whether the value cannot be in the Bloom filter, the value must have the type the filter was built for
+static bool BloomFilterExcludes(const BlockedBloomFilter &bloom_filter, const LogicalType &type, const Value &value) {
+	if (value.type() != type) {
+		return false;
+	}
+	if (value.IsNull()) {
+		// NULL never passes an equality filter
+		return true;
+	}
+	return !bloom_filter.Lookup(value.Hash());
+}
+
+//! Whether no value of the Bloom filter can pass the filter
+static bool BloomFilterExcludes(const BlockedBloomFilter &bloom_filter, const LogicalType &type,
+                                const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL) {
+			return false;
+		}
+		return BloomFilterExcludes(bloom_filter, type, constant_filter.constant);
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		for (auto &value : in_filter.values) {
+			if (!BloomFilterExcludes(bloom_filter, type, value)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (BloomFilterExcludes(bloom_filter, type, *child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (!BloomFilterExcludes(bloom_filter, type, *child_filter)) {
+				return false;
+			}
+		}
+		return !or_filter.child_filters.empty();
+	}
+	case TableFilterType::OPTIONAL_FILTER: {
+		auto &optional_filter = filter.Cast<OptionalFilter>();
+		return optional_filter.child_filter && BloomFilterExcludes(bloom_filter, type, *optional_filter.child_filter);
+	}
+	default:
+		return false;
+	}
+}
+
+FilterPropagateResult ColumnData::CheckBloomFilter(const TableFilter &filter) {
+	auto row_group_filter = GetBloomFilter();
+	if (!row_group_filter || !BloomFilterExcludes(*row_group_filter, type, filter)) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	lock_guard<mutex> l(update_lock);
+	if (!updates) {
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	// the updated values are not in the Bloom filter, they could pass the filter
+	auto update_stats = updates->GetStatistics();
+	if (filter.CheckStatistics(*update_stats) != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+}
+
+shared_ptr<BlockedBloomFilter> ColumnData::GetBloomFilter() const {
+	lock_guard<mutex> l(stats_lock);
+	return bloom_filter;
+}
+
+void ColumnData::SetBloomFilter(shared_ptr<BlockedBloomFilter> new_filter) {
+	lock_guard<mutex> l(stats_lock);
+	bloom_filter = std::move(new_filter);
+}
+
+bool ColumnData::KeepsVectorStatistics() const {
+	if (HasParent()) {
+		return false;
+	}
+	auto stats_type = BaseStatistics::GetStatsType(type);
+	return stats_type == StatisticsType::NUMERIC_STATS || stats_type == StatisticsType::STRING_STATS;
+}
+
+template <class T>
+static void UpdateVectorStatisticsInternal(BaseStatistics &stats, const UnifiedVectorFormat &vdata, idx_t offset,
+                                           idx_t count) {
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = offset; i < offset + count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			stats.SetHasNullFast();
+			continue;
+		}
+		stats.SetHasNoNullFast();
+		stats.UpdateNumericStats<T>(data[idx]);
+	}
+}
+
+template <>
+void UpdateVectorStatisticsInternal<string_t>(BaseStatistics &stats, const UnifiedVectorFormat &vdata, idx_t offset,
+                                              idx_t count) {
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+	for (idx_t i = offset; i < offset + count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			stats.SetHasNullFast();
+			continue;
+		}
+		stats.SetHasNoNullFast();
+		StringStats::Update(stats, data[idx]);
+	}
+}
+
+void ColumnData::UpdateVectorStatistics(BaseStatistics &stats, const UnifiedVectorFormat &vdata, idx_t offset,
+                                        idx_t count) {
+	switch (stats.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+		UpdateVectorStatisticsInternal<bool>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::INT8:
+		UpdateVectorStatisticsInternal<int8_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::INT16:
+		UpdateVectorStatisticsInternal<int16_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::INT32:
+		UpdateVectorStatisticsInternal<int32_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::INT64:
+		UpdateVectorStatisticsInternal<int64_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::UINT8:
+		UpdateVectorStatisticsInternal<uint8_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::UINT16:
+		UpdateVectorStatisticsInternal<uint16_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::UINT32:
+		UpdateVectorStatisticsInternal<uint32_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::UINT64:
+		UpdateVectorStatisticsInternal<uint64_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::INT128:
+		UpdateVectorStatisticsInternal<hugeint_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::UINT128:
+		UpdateVectorStatisticsInternal<uhugeint_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::FLOAT:
+		UpdateVectorStatisticsInternal<float>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::DOUBLE:
+		UpdateVectorStatisticsInternal<double>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::VARCHAR:
+		UpdateVectorStatisticsInternal<string_t>(stats, vdata, offset, count);
+		break;
+	default:
+		throw InternalException("Unsupported type for vector statistics");
+	}
+}
+
+shared_ptr<const vector<BaseStatistics>> ColumnData::LoadVectorStatistics() {
+	{
+		lock_guard<mutex> l(stats_lock);
+		if (vector_stats || !rebuild_vector_stats) {
+			return vector_stats;
+		}
+		rebuild_vector_stats = false;
+	}
+	// the vector stats are not persisted - rebuild them from the persistent segments
+	// appends never modify these segments, but "count" is incremented before the appended data is written
+	idx_t persistent_count = 0;
+	{
+		auto l = data.Lock();
+		for (auto segment = data.GetRootSegment(l); segment; segment = data.GetNextSegment(l, segment)) {
+			if (segment->segment_type != ColumnSegmentType::PERSISTENT) {
+				break;
+			}
+			persistent_count += segment->count;
+		}
+	}
+	// only keep stats for complete vectors, the last vector can still be appended to
+	const idx_t vector_count = persistent_count / STANDARD_VECTOR_SIZE;
+	auto new_stats = make_shared_ptr<vector<BaseStatistics>>();
+	Vector scan_vector(type);
+	UnifiedVectorFormat vdata;
+	for (idx_t vector_idx = 0; vector_idx < vector_count; vector_idx++) {
+		ScanCommittedRange(start, vector_idx * STANDARD_VECTOR_SIZE, STANDARD_VECTOR_SIZE, scan_vector);
+		scan_vector.ToUnifiedFormat(STANDARD_VECTOR_SIZE, vdata);
+		new_stats->push_back(BaseStatistics::CreateEmpty(type));
+		UpdateVectorStatistics(new_stats->back(), vdata, 0, STANDARD_VECTOR_SIZE);
+	}
+
+	lock_guard<mutex> l(stats_lock);
+	if (!vector_stats) {
+		vector_stats = std::move(new_stats);
+	}
+	return vector_stats;
+}
+
+void ColumnData::SetVectorStatistics(shared_ptr<const vector<BaseStatistics>> new_stats) {
+	lock_guard<mutex> l(stats_lock);
+	vector_stats = std::move(new_stats);
+	rebuild_vector_stats = false;
+}
+
 unique_ptr<BaseStatistics> ColumnData::GetStatistics() {
 	if (!stats) {
 		throw InternalException("ColumnData::GetStatistics called on a column without stats");
@@ -449,6 +726,12 @@ void ColumnData::MergeIntoStatistics(BaseStatistics &other) {
 }
 
 void ColumnData::InitializeAppend(ColumnAppendState &state) {
+	{
+		// the Bloom filter no longer covers all values of the row group
+		// the vector stats only cover complete vectors, which appends do not modify
+		lock_guard<mutex> guard(stats_lock);
+		bloom_filter.reset();
+	}
 	auto l = data.Lock();
 	if (data.IsEmpty(l)) {
 		// no segments yet, append an empty segment
@@ -680,6 +963,8 @@ void ColumnData::InitializeColumn(PersistentColumnData &column_data, BaseStatist
 		auto l = data.Lock();
 		AppendSegment(l, std::move(segment));
 	}
+	bloom_filter = std::move(column_data.bloom_filter);
+	rebuild_vector_stats = KeepsVectorStatistics();
 }
 
 bool ColumnData::IsPersistent() {
@@ -728,6 +1013,9 @@ void PersistentColumnData::Serialize(Serializer &serializer) const {
 		serializer.WriteList(102, "sub_columns", child_columns.size() - 1,
 		                     [&](Serializer::List &list, idx_t i) { list.WriteElement(child_columns[i + 1]); });
 	}
+	if (serializer.ShouldSerialize(6)) {
+		serializer.WritePropertyWithDefault(103, "bloom_filter", bloom_filter);
+	}
 }
 
 void PersistentColumnData::DeserializeField(Deserializer &deserializer, field_id_t field_idx, const char *field_name,
@@ -766,6 +1054,7 @@ PersistentColumnData PersistentColumnData::Deserialize(Deserializer &deserialize
 	default:
 		break;
 	}
+	deserializer.ReadPropertyWithDefault(103, "bloom_filter", result.bloom_filter);
 	return result;
 }
 
@@ -834,6 +1123,7 @@ bool PersistentCollectionData::HasUpdates() const {
 
 PersistentColumnData ColumnData::Serialize() {
 	PersistentColumnData result(type.InternalType(), GetDataPointers());
+	result.bloom_filter = GetBloomFilter();
 	result.has_updates = HasUpdates();
 	return result;
 }
@@ -6,6 +6,8 @@
 #include "duckdb/parser/column_definition.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 
 namespace duckdb {
 
@@ -299,6 +301,36 @@ bool ColumnDataCheckpointer::ValidityCoveredByBasedata(vector<CheckpointAnalyzeR
 	return base.function->validity == CompressionValidity::NO_VALIDITY_REQUIRED;
 }
 
+//! Bits per distinct value of the row group Bloom filters, gives a false positive rate of roughly 1%
+static constexpr idx_t ROW_GROUP_BLOOM_FILTER_BITS_PER_KEY = 10;
+
+static void AppendValueHashes(Vector &scan_vector, idx_t count, vector<hash_t> &value_hashes) {
+	Vector hashes(LogicalType::HASH, count);
+	VectorOperations::Hash(scan_vector, hashes, count);
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	for (idx_t i = 0; i < count; i++) {
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(i))) {
+			continue;
+		}
+		value_hashes.push_back(hash_data[hdata.sel->get_index(i)]);
+	}
+}
+
+static shared_ptr<BlockedBloomFilter> CreateBloomFilter(vector<hash_t> &value_hashes) {
+	// size the filter for the distinct values of the row group
+	std::sort(value_hashes.begin(), value_hashes.end());
+	value_hashes.erase(std::unique(value_hashes.begin(), value_hashes.end()), value_hashes.end());
+	auto result = make_shared_ptr<BlockedBloomFilter>(value_hashes.size(), ROW_GROUP_BLOOM_FILTER_BITS_PER_KEY);
+	for (auto &hash : value_hashes) {
+		result->Insert(hash);
+	}
+	return result;
+}
+
 void ColumnDataCheckpointer::WriteToDisk() {
 	DropSegments();
 
@@ -333,8 +365,41 @@ void ColumnDataCheckpointer::WriteToDisk() {
 		compression_states[i] = function->init_compression(checkpoint_data[i], std::move(analyze_state));
 	}
 
+	// Set up the statistics of every vector of the row group
+	vector_stats.resize(checkpoint_states.size());
+	optional_ptr<vector<BaseStatistics>> column_vector_stats;
+	auto &first_col_data = checkpoint_states[0].get().column_data;
+	if (has_changes[0] && first_col_data.KeepsVectorStatistics()) {
+		column_vector_stats = vector_stats[0];
+	}
+	// Collect the hashes of the values of the row group if the column has a Bloom filter
+	bloom_filters.resize(checkpoint_states.size());
+	const bool build_bloom_filter = has_changes[0] && checkpoint_info.HasBloomFilter() &&
+	                                !first_col_data.HasParent() &&
+	                                ColumnData::SupportsBloomFilter(first_col_data.type);
+	vector<hash_t> value_hashes;
+
 	// Scan over the existing segment + changes and compress the data
+	idx_t scanned_rows = 0;
 	ScanSegments([&](Vector &scan_vector, idx_t count) {
+		if (column_vector_stats) {
+			UnifiedVectorFormat vdata;
+			scan_vector.ToUnifiedFormat(count, vdata);
+			for (idx_t offset = 0; offset < count;) {
+				const auto vector_idx = scanned_rows / STANDARD_VECTOR_SIZE;
+				if (vector_idx == column_vector_stats->size()) {
+					column_vector_stats->push_back(BaseStatistics::CreateEmpty(first_col_data.type));
+				}
+				const auto to_update =
+				    MinValue<idx_t>(count - offset, STANDARD_VECTOR_SIZE - scanned_rows % STANDARD_VECTOR_SIZE);
+				ColumnData::UpdateVectorStatistics((*column_vector_stats)[vector_idx], vdata, offset, to_update);
+				offset += to_update;
+				scanned_rows += to_update;
+			}
+		}
+		if (build_bloom_filter) {
+			AppendValueHashes(scan_vector, count, value_hashes);
+		}
 		for (idx_t i = 0; i < checkpoint_states.size(); i++) {
 			if (!has_changes[i]) {
 				continue;
@@ -345,6 +410,11 @@ void ColumnDataCheckpointer::WriteToDisk() {
 		}
 	});
 
+	if (column_vector_stats && scanned_rows % STANDARD_VECTOR_SIZE != 0) {
+		// the last vector is not complete - appends to it would invalidate its statistics
+		column_vector_stats->pop_back();
+	}
+
 	// Finalize the compression
 	for (idx_t i = 0; i < checkpoint_states.size(); i++) {
 		if (!has_changes[i]) {
@@ -354,6 +424,9 @@ void ColumnDataCheckpointer::WriteToDisk() {
 		auto &compression_state = compression_states[i];
 		function->compress_finalize(*compression_state);
 	}
+	if (build_bloom_filter) {
+		bloom_filters[0] = CreateBloomFilter(value_hashes);
+	}
 }
 
 bool ColumnDataCheckpointer::HasChanges(ColumnData &col_data) {
@@ -426,6 +499,12 @@ void ColumnDataCheckpointer::FinalizeCheckpoint() {
 			// Move the existing segments out of the column data
 			// they will be destructed at the end of the scope
 			auto to_delete = col_data.data.MoveSegments();
+			shared_ptr<const vector<BaseStatistics>> new_vector_stats;
+			if (!vector_stats[i].empty()) {
+				new_vector_stats = make_shared_ptr<vector<BaseStatistics>>(std::move(vector_stats[i]));
+			}
+			col_data.SetVectorStatistics(std::move(new_vector_stats));
+			col_data.SetBloomFilter(std::move(bloom_filters[i]));
 		} else {
 			WritePersistentSegments(state);
 		}
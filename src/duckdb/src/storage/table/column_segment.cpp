@@ -5,6 +5,7 @@
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
@@ -615,6 +616,12 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		sel.Initialize(result_sel);
 		return approved_tuple_count;
 	}
+	case TableFilterType::BLOOM_FILTER: {
+		auto &bloom_filter = filter.Cast<BloomFilter>();
+		auto &state = filter_state.Cast<BloomFilterState>();
+		approved_tuple_count = bloom_filter.Filter(vector, vdata, sel, scan_count, approved_tuple_count, state);
+		return approved_tuple_count;
+	}
 	default:
 		throw InternalException("FIXME: unsupported type for filter selection");
 	}
@@ -23,6 +23,7 @@
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/filter/optional_filter.hpp"
 #include "duckdb/execution/adaptive_filter.hpp"
+#include "duckdb/logging/logger.hpp"
 
 namespace duckdb {
 
@@ -426,6 +427,14 @@ bool RowGroup::CheckZonemap(ScanFilterInfo &filters) {
 			prune_result = CheckRowIdFilter(filter, this->start, this->start + this->count);
 		} else {
 			prune_result = GetColumn(base_column_index).CheckZonemap(filter);
+			if (prune_result == FilterPropagateResult::NO_PRUNING_POSSIBLE) {
+				prune_result = GetColumn(base_column_index).CheckBloomFilter(filter);
+				if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+					DUCKDB_LOG_TRACE(GetCollection().GetAttached().GetDatabase(),
+					                 "RowGroup skipped the row group starting at row %llu with a Bloom filter",
+					                 this->start);
+				}
+			}
 		}
 
 		if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
@@ -443,6 +452,49 @@ bool RowGroup::CheckZonemap(ScanFilterInfo &filters) {
 	return true;
 }
 
+void RowGroup::ReadAhead(CollectionScanState &state) {
+	auto &block_manager = GetBlockManager();
+	if (block_manager.InMemory() || block_manager.IsRemote()) {
+		// remote files are prefetched in Scan instead
+		return;
+	}
+	auto &config = DBConfig::GetConfig(block_manager.buffer_manager.GetDatabase());
+	if (config.options.read_ahead_threads == 0) {
+		return;
+	}
+	// skip row groups that the scan is going to prune using the zonemap
+	// note that we cannot use CheckZonemap here, as it modifies the filter state of the row group being scanned
+	for (auto &entry : state.GetFilterInfo().GetFilterList()) {
+		FilterPropagateResult prune_result;
+		if (entry.table_column_index == COLUMN_IDENTIFIER_ROW_ID) {
+			prune_result = CheckRowIdFilter(entry.filter, this->start, this->start + this->count);
+		} else {
+			prune_result = GetColumn(entry.table_column_index).CheckZonemap(entry.filter);
+			if (prune_result == FilterPropagateResult::NO_PRUNING_POSSIBLE) {
+				prune_result = GetColumn(entry.table_column_index).CheckBloomFilter(entry.filter);
+			}
+		}
+		if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			return;
+		}
+	}
+	auto &column_ids = state.GetColumnIds();
+	auto &types = GetCollection().GetTypes();
+	PrefetchState prefetch_state;
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		const auto &column = column_ids[i];
+		if (column.IsRowIdColumn()) {
+			continue;
+		}
+		ColumnScanState column_state;
+		column_state.Initialize(types[column.GetPrimaryIndex()], column.GetChildIndexes(), &state.GetOptions());
+		auto &column_data = GetColumn(column);
+		column_data.InitializeScan(column_state);
+		column_data.InitializePrefetch(prefetch_state, column_state, this->count);
+	}
+	block_manager.ReadAhead(prefetch_state.blocks);
+}
+
 bool RowGroup::CheckZonemapSegments(CollectionScanState &state) {
 	auto &filters = state.GetFilterInfo();
 	for (auto &entry : filters.GetFilterList()) {
@@ -462,6 +514,19 @@ bool RowGroup::CheckZonemapSegments(CollectionScanState &state) {
 		}
 
 		if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			// the segment cannot be skipped - check if we can skip the vector we are about to scan
+			if (base_column_idx != COLUMN_IDENTIFIER_ROW_ID) {
+				auto &column = GetColumn(base_column_idx);
+				auto &column_scan_state = state.column_scans[column_idx];
+				if (column.CheckVectorZonemap(column_scan_state, state.vector_index, filter) ==
+				    FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+					DUCKDB_LOG_TRACE(GetCollection().GetAttached().GetDatabase(),
+					                 "RowGroup skipped vector %llu of the row group starting at row %llu",
+					                 state.vector_index, this->start);
+					NextVector(state);
+					return false;
+				}
+			}
 			continue;
 		}
 
@@ -963,6 +1028,10 @@ CompressionType ColumnCheckpointInfo::GetCompressionType() {
 	return info.compression_types[column_idx];
 }
 
+bool ColumnCheckpointInfo::HasBloomFilter() {
+	return info.bloom_filters[column_idx];
+}
+
 RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
 	RowGroupWriteData result;
 	result.states.reserve(columns.size());
@@ -1012,6 +1081,8 @@ bool RowGroup::HasUnloadedDeletes() const {
 RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
 	vector<CompressionType> compression_types;
 	compression_types.reserve(columns.size());
+	vector<bool> bloom_filters;
+	bloom_filters.reserve(columns.size());
 
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
 		auto &column = GetColumn(column_idx);
@@ -1022,9 +1093,11 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
 		}
 		auto compression_type = writer.GetColumnCompressionType(column_idx);
 		compression_types.push_back(compression_type);
+		bloom_filters.push_back(writer.HasColumnBloomFilter(column_idx));
 	}
 
-	RowGroupWriteInfo info(writer.GetPartialBlockManager(), compression_types, writer.GetCheckpointType());
+	RowGroupWriteInfo info(writer.GetPartialBlockManager(), compression_types, bloom_filters,
+	                       writer.GetCheckpointType());
 	return WriteToDisk(info);
 }
 
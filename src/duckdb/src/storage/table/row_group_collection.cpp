@@ -150,6 +150,12 @@ void RowGroupCollection::InitializeScan(CollectionScanState &state, const vector
 	while (row_group && !row_group->InitializeScan(state)) {
 		row_group = row_groups->GetNextSegment(row_group);
 	}
+	if (row_group) {
+		auto next = row_groups->GetNextSegment(row_group);
+		if (next && next->start < state.max_row) {
+			next->ReadAhead(state);
+		}
+	}
 }
 
 void RowGroupCollection::InitializeCreateIndexScan(CreateIndexScanState &state) {
@@ -196,6 +202,7 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 		idx_t max_row;
 		RowGroupCollection *collection;
 		RowGroup *row_group;
+		RowGroup *next_row_group = nullptr;
 		{
 			// select the next row group to scan from the parallel state
 			lock_guard<mutex> l(state.lock);
@@ -221,6 +228,9 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 				vector_index = 0;
 				max_row = state.current_row_group->start + state.current_row_group->count;
 				state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+				if (state.current_row_group && state.current_row_group->start < state.max_row) {
+					next_row_group = state.current_row_group;
+				}
 			}
 			max_row = MinValue<idx_t>(max_row, state.max_row);
 			scan_state.batch_index = ++state.batch_index;
@@ -230,6 +240,10 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 
 		// initialize the scan for this row group
 		bool need_to_scan = InitializeScanInRowGroup(scan_state, *collection, *row_group, vector_index, max_row);
+		if (next_row_group) {
+			// start loading the row group that is handed out next, while this one is being scanned
+			next_row_group->ReadAhead(scan_state);
+		}
 		if (!need_to_scan) {
 			// skip this row group
 			continue;
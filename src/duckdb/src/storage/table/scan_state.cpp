@@ -197,7 +197,11 @@ bool CollectionScanState::Scan(DuckTransaction &transaction, DataChunk &result)
 					}
 					bool scan_row_group = row_group->InitializeScan(*this);
 					if (scan_row_group) {
-						// scan this row group
+						// scan this row group, and start loading the next one in the background
+						auto next = row_groups->GetNextSegment(row_group);
+						if (next && next->start < max_row) {
+							next->ReadAhead(*this);
+						}
 						break;
 					}
 				}
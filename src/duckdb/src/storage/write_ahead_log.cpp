@@ -102,6 +102,20 @@ void WriteAheadLog::Delete() {
 	wal_size = 0;
 }
 
+void WriteAheadLog::Move(const string &new_path) {
+	lock_guard<mutex> lock(wal_lock);
+	if (init_state != WALInitState::NO_WAL) {
+		if (writer) {
+			writer->Sync();
+			writer.reset();
+			init_state = WALInitState::UNINITIALIZED;
+		}
+		auto &fs = FileSystem::Get(database);
+		fs.MoveFile(wal_path, new_path);
+	}
+	wal_path = new_path;
+}
+
 //===--------------------------------------------------------------------===//
 // Serializer
 //===--------------------------------------------------------------------===//
@@ -494,6 +508,12 @@ void WriteAheadLog::WriteUpdate(DataChunk &chunk, const vector<column_t> &column
 // Write ALTER Statement
 //===--------------------------------------------------------------------===//
 void WriteAheadLog::WriteAlter(CatalogEntry &entry, const AlterInfo &info) {
+	if (info.type == AlterType::ALTER_TABLE &&
+	    info.Cast<AlterTableInfo>().alter_table_type == AlterTableType::SET_BLOOM_FILTER &&
+	    !SerializationOptions(database).serialization_compatibility.Compare(6)) {
+		// older versions cannot replay this alter - declaring the Bloom filter should have been rejected
+		throw InternalException("SET_BLOOM_FILTER cannot be written to the WAL with a storage version before v1.4.0");
+	}
 	WriteAheadLogSerializer serializer(*this, WALType::ALTER_INFO);
 	serializer.WriteProperty(101, "info", &info);
 
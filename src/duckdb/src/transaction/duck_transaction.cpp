@@ -282,8 +282,25 @@ void DuckTransaction::Cleanup(transaction_t lowest_active_transaction) {
 
 void DuckTransaction::SetReadWrite() {
 	Transaction::SetReadWrite();
-	// obtain a shared checkpoint lock to prevent concurrent checkpoints while this transaction is running
-	write_lock = transaction_manager.SharedCheckpointLock();
+	AcquireCheckpointLock();
+}
+
+void DuckTransaction::SetAppendOnly() {
+	// appends stay in transaction-local storage until the commit - the checkpoint lock is obtained when committing,
+	// or when the appended row groups are written to disk optimistically
+	Transaction::SetReadWrite();
+}
+
+void DuckTransaction::UpgradeAppendOnly() {
+	AcquireCheckpointLock();
+}
+
+void DuckTransaction::AcquireCheckpointLock() {
+	lock_guard<mutex> guard(write_lock_lock);
+	if (!write_lock) {
+		// obtain a shared checkpoint lock to prevent concurrent checkpoints while this transaction is running
+		write_lock = transaction_manager.SharedCheckpointLock();
+	}
 }
 
 unique_ptr<StorageLockKey> DuckTransaction::TryGetCheckpointLock() {
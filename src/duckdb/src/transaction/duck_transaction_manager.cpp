@@ -4,17 +4,24 @@
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/reference_map.hpp"
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/dependency_manager.hpp"
+#include "duckdb/logging/logger.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/valid_checker.hpp"
+#include "duckdb/transaction/local_storage.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 void DuckCleanupInfo::Cleanup() noexcept {
@@ -29,6 +36,149 @@ bool DuckCleanupInfo::ScheduleCleanup() noexcept {
 	return !transactions.empty();
 }
 
+struct BackgroundCheckpointState {
+	explicit BackgroundCheckpointState(DuckTransactionManager &manager) : manager(&manager) {
+	}
+
+	//! Held while a background checkpoint is running
+	mutex lock;
+	//! The transaction manager - cleared when the database is closed
+	optional_ptr<DuckTransactionManager> manager;
+	//! Whether a background checkpoint task is scheduled and has not started yet
+	atomic<bool> scheduled {false};
+
+	//! Protects the fields below
+	mutex state_lock;
+	//! Signalled when a table has been checkpointed, or when a commit or the checkpoint has finished
+	std::condition_variable commit_cv;
+	//! Whether background checkpoints have been stopped
+	bool stopped = false;
+	//! Whether commits are written to a new WAL while the background checkpoint writes the rotated WAL
+	bool wal_rotated = false;
+	//! The tables that have been written by the running background checkpoint
+	reference_set_t<DataTable> checkpointed_tables;
+	//! The number of commits that are writing to the new WAL
+	idx_t active_commits = 0;
+	//! The error of a failed background checkpoint - reported to the next commit
+	ErrorData error;
+
+	//! Prepares the commit of a transaction that only appended to tables and has not obtained the checkpoint lock.
+	//! Returns true if the transaction commits while a background checkpoint is running, after the checkpoint has
+	//! written the tables the transaction appends to. Otherwise, the transaction obtains the checkpoint lock.
+	bool BeginCommit(DuckTransaction &transaction) {
+		auto &local_storage = transaction.GetLocalStorage();
+		auto tables = local_storage.GetTables();
+		unique_lock<mutex> guard(state_lock);
+		while (wal_rotated && CanCommitDuringCheckpoint(local_storage, tables)) {
+			bool tables_checkpointed = true;
+			for (auto &table : tables) {
+				if (checkpointed_tables.find(table) == checkpointed_tables.end()) {
+					tables_checkpointed = false;
+					break;
+				}
+			}
+			if (tables_checkpointed) {
+				active_commits++;
+				return true;
+			}
+			commit_cv.wait(guard);
+		}
+		guard.unlock();
+		transaction.AcquireCheckpointLock();
+		return false;
+	}
+
+	//! Re-checks whether the appends can be committed without the checkpoint lock - called while the background
+	//! checkpoint holds the exclusive lock, so no index can be created concurrently
+	static bool CanCommitDuringCheckpoint(LocalStorage &local_storage, const vector<reference<DataTable>> &tables) {
+		for (auto &table : tables) {
+			if (table.get().HasIndexes()) {
+				// an index was created after the insert was bound
+				return false;
+			}
+			if (local_storage.WritesRowGroupsOnCommit(table)) {
+				// optimistic writes need the checkpoint lock, which the checkpoint only releases after the commits
+				// writing to the new WAL have finished
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void EndCommit() {
+		lock_guard<mutex> guard(state_lock);
+		active_commits--;
+		commit_cv.notify_all();
+	}
+
+	ErrorData TakeError() {
+		lock_guard<mutex> guard(state_lock);
+		auto result = std::move(error);
+		error = ErrorData();
+		return result;
+	}
+};
+
+//! Tracks the commit of a transaction that only appended to tables while a background checkpoint is running
+class BackgroundCheckpointCommit {
+public:
+	BackgroundCheckpointCommit(BackgroundCheckpointState &state, DuckTransaction &transaction) : state(state) {
+		if (!transaction.IsReadOnly() && !transaction.HasWriteLock() && transaction.ChangesMade()) {
+			active = state.BeginCommit(transaction);
+		}
+	}
+	~BackgroundCheckpointCommit() {
+		if (active) {
+			state.EndCommit();
+		}
+	}
+
+	bool IsActive() const {
+		return active;
+	}
+
+private:
+	BackgroundCheckpointState &state;
+	bool active = false;
+};
+
+class BackgroundCheckpointTask : public Task {
+public:
+	explicit BackgroundCheckpointTask(shared_ptr<BackgroundCheckpointState> state_p) : state(std::move(state_p)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		lock_guard<mutex> guard(state->lock);
+		// commits that cross the threshold from now on schedule a new checkpoint
+		state->scheduled = false;
+		if (!state->manager) {
+			// the database has been closed
+			return TaskExecutionResult::TASK_FINISHED;
+		}
+		try {
+			state->manager->BackgroundCheckpoint();
+		} catch (std::exception &ex) {
+			ErrorData error(ex);
+			auto &db = state->manager->GetDB().GetDatabase();
+			DUCKDB_LOG_WARN(db, "Background checkpoint failed: %s", error.Message());
+			if (Exception::InvalidatesDatabase(error.Type())) {
+				ValidChecker::Invalidate(db, error.RawMessage());
+			}
+			// fail the next commit with the error
+			lock_guard<mutex> guard(state->state_lock);
+			state->error = std::move(error);
+		}
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+	string TaskType() const override {
+		return "BackgroundCheckpointTask";
+	}
+
+private:
+	shared_ptr<BackgroundCheckpointState> state;
+};
+
 DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : TransactionManager(db) {
 	// start timestamp starts at two
 	current_start_timestamp = 2;
@@ -43,9 +193,11 @@ DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : Transacti
 		// Specifically the StorageManager of the DuckCatalog is relied on, with `db.GetStorageManager`
 		throw InternalException("DuckTransactionManager should only be created together with a DuckCatalog");
 	}
+	background_checkpoint = make_shared_ptr<BackgroundCheckpointState>(*this);
 }
 
 DuckTransactionManager::~DuckTransactionManager() {
+	StopBackgroundCheckpoints();
 }
 
 DuckTransactionManager &DuckTransactionManager::Get(AttachedDatabase &db) {
@@ -116,6 +268,12 @@ DuckTransactionManager::CanCheckpoint(DuckTransaction &transaction, unique_ptr<S
 	if (config.options.debug_skip_checkpoint_on_commit) {
 		return CheckpointDecision("checkpointing on commit disabled through configuration");
 	}
+	if (config.options.background_checkpoint && TaskScheduler::GetScheduler(db.GetDatabase()).NumberOfThreads() > 1) {
+		// write this commit to the WAL and leave the checkpoint to a background thread
+		CheckpointDecision decision("checkpointing in the background");
+		decision.background = true;
+		return decision;
+	}
 	// try to lock the checkpoint lock
 	lock = transaction.TryGetCheckpointLock();
 	if (!lock) {
@@ -210,6 +368,94 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 	storage_manager.CreateCheckpoint(QueryContext(context), options);
 }
 
+void DuckTransactionManager::ScheduleBackgroundCheckpoint() {
+	if (background_checkpoint->scheduled.exchange(true)) {
+		// a checkpoint is already scheduled
+		return;
+	}
+	lock_guard<mutex> guard(background_checkpoint->state_lock);
+	if (background_checkpoint->stopped) {
+		return;
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+	if (!background_checkpoint_producer) {
+		background_checkpoint_producer = scheduler.CreateProducer();
+	}
+	scheduler.ScheduleTask(*background_checkpoint_producer,
+	                       make_shared_ptr<BackgroundCheckpointTask>(background_checkpoint));
+}
+
+void DuckTransactionManager::BackgroundCheckpoint() {
+	auto &storage_manager = db.GetStorageManager();
+	if (!storage_manager.AutomaticCheckpoint(0)) {
+		// another checkpoint has already cleared the WAL
+		return;
+	}
+	auto &state = *background_checkpoint;
+	unique_ptr<StorageLockKey> lock;
+	{
+		lock_guard<mutex> guard(state.state_lock);
+		lock = checkpoint_lock.TryGetExclusiveLock();
+		if (!lock) {
+			// there are write transactions active - the next commit that crosses the threshold schedules a new attempt
+			return;
+		}
+		// direct commits to a new WAL - transactions that only append to tables commit into it as soon as the
+		// checkpoint has written their tables, instead of waiting for the entire checkpoint
+		state.wal_rotated = storage_manager.RotateWAL();
+	}
+	CheckpointOptions options;
+	options.action = CheckpointAction::ALWAYS_CHECKPOINT;
+	if (GetLastCommit() > LowestActiveStart()) {
+		// we cannot do a full checkpoint if any transaction needs to read old data
+		options.type = CheckpointType::CONCURRENT_CHECKPOINT;
+	}
+	try {
+		storage_manager.CreateCheckpoint(QueryContext(), options);
+	} catch (...) {
+		EndBackgroundCheckpointCommits();
+		throw;
+	}
+	EndBackgroundCheckpointCommits();
+}
+
+void DuckTransactionManager::EndBackgroundCheckpointCommits() {
+	auto &state = *background_checkpoint;
+	unique_lock<mutex> guard(state.state_lock);
+	if (!state.wal_rotated) {
+		return;
+	}
+	// commits that are still waiting for a table obtain the checkpoint lock instead
+	state.wal_rotated = false;
+	state.checkpointed_tables.clear();
+	state.commit_cv.notify_all();
+	// the new WAL can only be moved once the commits writing to it have finished
+	state.commit_cv.wait(guard, [&]() { return state.active_commits == 0; });
+	db.GetStorageManager().EndWALRotation();
+}
+
+void DuckTransactionManager::OnTableCheckpointed(DataTable &table) {
+	auto &state = *background_checkpoint;
+	lock_guard<mutex> guard(state.state_lock);
+	if (!state.wal_rotated) {
+		return;
+	}
+	state.checkpointed_tables.insert(table);
+	state.commit_cv.notify_all();
+}
+
+void DuckTransactionManager::StopBackgroundCheckpoints() {
+	{
+		lock_guard<mutex> guard(background_checkpoint->state_lock);
+		background_checkpoint->stopped = true;
+	}
+	// wait for a running background checkpoint to finish
+	lock_guard<mutex> guard(background_checkpoint->lock);
+	background_checkpoint->manager = nullptr;
+	// the producer refers to the queue of the task scheduler, which can be destroyed before this transaction manager
+	background_checkpoint_producer.reset();
+}
+
 unique_ptr<StorageLockKey> DuckTransactionManager::SharedCheckpointLock() {
 	return checkpoint_lock.GetSharedLock();
 }
@@ -226,6 +472,9 @@ transaction_t DuckTransactionManager::GetCommitTimestamp() {
 
 ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Transaction &transaction_p) {
 	auto &transaction = transaction_p.Cast<DuckTransaction>();
+	// transactions that only appended to tables obtain the checkpoint lock here - or commit into a new WAL while a
+	// background checkpoint is running
+	BackgroundCheckpointCommit background_commit(*background_checkpoint, transaction);
 	unique_lock<mutex> t_lock(transaction_lock);
 	if (!db.IsSystem() && !db.IsTemporary()) {
 		if (transaction.ChangesMade()) {
@@ -239,16 +488,22 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	// check if we can checkpoint
 	unique_ptr<StorageLockKey> lock;
 	auto undo_properties = transaction.GetUndoProperties();
-	auto checkpoint_decision = CanCheckpoint(transaction, lock, undo_properties);
+	auto checkpoint_decision = background_commit.IsActive()
+	                               ? CheckpointDecision("a background checkpoint is running")
+	                               : CanCheckpoint(transaction, lock, undo_properties);
 	ErrorData error;
+	if (transaction.ChangesMade()) {
+		// a failed background checkpoint fails the next commit that makes changes
+		error = background_checkpoint->TakeError();
+	}
 	unique_ptr<lock_guard<mutex>> held_wal_lock;
 	unique_ptr<StorageCommitState> commit_state;
-	if (!checkpoint_decision.can_checkpoint && transaction.ShouldWriteToWAL(db)) {
+	if (!error.HasError() && !checkpoint_decision.can_checkpoint && transaction.ShouldWriteToWAL(db)) {
 		// if we are committing changes and we are not checkpointing, we need to write to the WAL
 		// since WAL writes can take a long time - we grab the WAL lock here and unlock the transaction lock
 		// read-only transactions can bypass this branch and start/commit while the WAL write is happening
-		if (!transaction.HasWriteLock()) {
-			// sanity check - this transaction should have a write lock
+		if (!transaction.HasWriteLock() && !background_commit.IsActive()) {
+			// sanity check - this transaction should have a write lock (or commit alongside a background checkpoint)
 			// the write lock prevents other transactions from checkpointing until this transaction is fully finished
 			// if we do not hold the write lock here, other transactions can bypass this branch by auto-checkpoint
 			// this would lead to a checkpoint WHILE this thread is writing to the WAL
@@ -337,6 +592,9 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		options.type = checkpoint_decision.type;
 		auto &storage_manager = db.GetStorageManager();
 		storage_manager.CreateCheckpoint(QueryContext(context), options);
+	} else if (checkpoint_decision.background) {
+		// the commit has been written to the WAL - checkpoint on a background thread so the commit does not wait
+		ScheduleBackgroundCheckpoint();
 	}
 	return error;
 }
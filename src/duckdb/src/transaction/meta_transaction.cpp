@@ -157,7 +157,7 @@ void MetaTransaction::SetActiveQuery(transaction_t query_number) {
 	}
 }
 
-void MetaTransaction::ModifyDatabase(AttachedDatabase &db) {
+void MetaTransaction::ModifyDatabase(AttachedDatabase &db, bool append_only) {
 	if (db.IsSystem() || db.IsTemporary()) {
 		// we can always modify the system and temp databases
 		return;
@@ -168,9 +168,14 @@ void MetaTransaction::ModifyDatabase(AttachedDatabase &db) {
 	}
 	if (!modified_database) {
 		modified_database = &db;
+		modified_database_append_only = append_only;
 
 		auto &transaction = GetTransaction(db);
-		transaction.SetReadWrite();
+		if (append_only) {
+			transaction.SetAppendOnly();
+		} else {
+			transaction.SetReadWrite();
+		}
 		return;
 	}
 	if (&db != modified_database.get()) {
@@ -179,6 +184,11 @@ void MetaTransaction::ModifyDatabase(AttachedDatabase &db) {
 		    "single transaction can only write to a single attached database.",
 		    db.GetName(), modified_database->GetName());
 	}
+	if (modified_database_append_only && !append_only) {
+		// the transaction no longer only appends
+		modified_database_append_only = false;
+		GetTransaction(db).UpgradeAppendOnly();
+	}
 }
 
 } // namespace duckdb
@@ -21,4 +21,11 @@ void Transaction::SetReadWrite() {
 	is_read_only = false;
 }
 
+void Transaction::SetAppendOnly() {
+	SetReadWrite();
+}
+
+void Transaction::UpgradeAppendOnly() {
+}
+
 } // namespace duckdb
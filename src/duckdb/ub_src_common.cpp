@@ -40,6 +40,10 @@
 
 #include "src/common/hive_partitioning.cpp"
 
+#include "src/common/io_uring.cpp"
+
+#include "src/common/numa.cpp"
+
 #include "src/common/pipe_file_system.cpp"
 
 #include "src/common/local_file_system.cpp"
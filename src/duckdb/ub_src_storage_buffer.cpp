@@ -4,6 +4,8 @@
 
 #include "src/storage/buffer/block_manager.cpp"
 
+#include "src/storage/buffer/block_read_ahead.cpp"
+
 #include "src/storage/buffer/buffer_pool.cpp"
 
 #include "src/storage/buffer/buffer_pool_reservation.cpp"
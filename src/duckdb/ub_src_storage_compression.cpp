@@ -28,3 +28,5 @@
 
 #include "src/storage/compression/empty_validity.cpp"
 
+#include "src/storage/compression/range_filter.cpp"
+
@@ -0,0 +1,69 @@
+#include "arrow_query_stream.hpp"
+
+#include "duckdb/common/arrow/arrow_converter.hpp"
+
+using namespace duckdb;
+
+ArrowQueryStream::ArrowQueryStream(unique_ptr<QueryResult> result_p) : result(std::move(result_p)) {
+	D_ASSERT(result->type == QueryResultType::ARROW_RESULT);
+	arrays = result->Cast<ArrowQueryResult>().ConsumeArrays();
+
+	stream.private_data = this;
+	stream.get_schema = ArrowQueryStream::GetSchema;
+	stream.get_next = ArrowQueryStream::GetNext;
+	stream.release = ArrowQueryStream::Release;
+	stream.get_last_error = ArrowQueryStream::GetLastError;
+}
+
+int ArrowQueryStream::GetSchema(struct ArrowArrayStream *stream, struct ArrowSchema *out) {
+	if (!stream->release) {
+		return -1;
+	}
+	out->release = nullptr;
+	auto self = reinterpret_cast<ArrowQueryStream *>(stream->private_data);
+	try {
+		auto &res = *self->result;
+		ArrowConverter::ToArrowSchema(out, res.types, res.names, res.client_properties);
+	} catch (std::exception &e) {
+		self->last_error = ErrorData(e).Message();
+		return -1;
+	}
+	return 0;
+}
+
+int ArrowQueryStream::GetNext(struct ArrowArrayStream *stream, struct ArrowArray *out) {
+	if (!stream->release) {
+		return -1;
+	}
+	auto self = reinterpret_cast<ArrowQueryStream *>(stream->private_data);
+	if (self->next_array >= self->arrays.size()) {
+		// end of stream
+		out->release = nullptr;
+		return 0;
+	}
+	// move the array to the consumer, it is released by it
+	auto &array = self->arrays[self->next_array++];
+	*out = array->arrow_array;
+	array->arrow_array.release = nullptr;
+	array.reset();
+	return 0;
+}
+
+void ArrowQueryStream::Release(struct ArrowArrayStream *stream) {
+	if (!stream || !stream->release) {
+		return;
+	}
+	stream->release = nullptr;
+	delete reinterpret_cast<ArrowQueryStream *>(stream->private_data);
+}
+
+const char *ArrowQueryStream::GetLastError(struct ArrowArrayStream *stream) {
+	if (!stream->release) {
+		return "stream was released";
+	}
+	auto self = reinterpret_cast<ArrowQueryStream *>(stream->private_data);
+	if (self->last_error.empty()) {
+		return nullptr;
+	}
+	return self->last_error.c_str();
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/arrow/arrow_query_result.hpp"
+
+/**
+ * ArrowArrayStream over the arrays of an ArrowQueryResult. The arrays are produced (in parallel when the plan
+ * allows it) by PhysicalArrowCollector while the query runs, so the stream only hands them over to the consumer.
+ *
+ * The stream owns itself, it is deleted when its release callback is called.
+ */
+class ArrowQueryStream {
+public:
+	explicit ArrowQueryStream(duckdb::unique_ptr<duckdb::QueryResult> result);
+
+	ArrowQueryStream(const ArrowQueryStream &) = delete;
+	ArrowQueryStream &operator=(const ArrowQueryStream &) = delete;
+
+	ArrowArrayStream stream;
+
+private:
+	static int GetSchema(struct ArrowArrayStream *stream, struct ArrowSchema *out);
+	static int GetNext(struct ArrowArrayStream *stream, struct ArrowArray *out);
+	static void Release(struct ArrowArrayStream *stream);
+	static const char *GetLastError(struct ArrowArrayStream *stream);
+
+	duckdb::unique_ptr<duckdb::QueryResult> result;
+	duckdb::vector<duckdb::unique_ptr<duckdb::ArrowArrayWrapper>> arrays;
+	idx_t next_array = 0;
+	std::string last_error;
+};
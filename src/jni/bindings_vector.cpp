@@ -2,6 +2,7 @@
 #include "refs.hpp"
 #include "util.hpp"
 
+#include <cstring>
 #include <vector>
 
 static duckdb_vector vector_buf_to_vector(JNIEnv *env, jobject vector_buf) {
@@ -166,6 +167,100 @@ JNIEXPORT void JNICALL Java_org_duckdb_DuckDBBindings_duckdb_1vector_1assign_1st
 	duckdb_vector_assign_string_element_len(vec, idx, str_ptr.get(), len);
 }
 
+/*
+ * Class:     org_duckdb_DuckDBBindings
+ * Method:    duckdb_vector_assign_string_elements
+ * Signature: (Ljava/nio/ByteBuffer;JJLjava/nio/ByteBuffer;Ljava/nio/ByteBuffer;)V
+ */
+JNIEXPORT void JNICALL Java_org_duckdb_DuckDBBindings_duckdb_1vector_1assign_1string_1elements(
+    JNIEnv *env, jclass, jobject vector, jlong start_index, jlong count, jobject data, jobject offsets) {
+
+	duckdb_vector vec = vector_buf_to_vector(env, vector);
+	if (env->ExceptionCheck()) {
+		return;
+	}
+	idx_t start = jlong_to_idx(env, start_index);
+	if (env->ExceptionCheck()) {
+		return;
+	}
+	idx_t cnt = jlong_to_idx(env, count);
+	if (env->ExceptionCheck()) {
+		return;
+	}
+	if (cnt == 0) {
+		return;
+	}
+	if (start + cnt > duckdb_vector_size()) {
+		env->ThrowNew(J_SQLException, "Invalid string elements range");
+		return;
+	}
+
+	if (data == nullptr || offsets == nullptr) {
+		env->ThrowNew(J_SQLException, "Invalid string elements buffer");
+		return;
+	}
+	auto data_ptr = reinterpret_cast<const char *>(env->GetDirectBufferAddress(data));
+	auto offsets_ptr = reinterpret_cast<const int32_t *>(env->GetDirectBufferAddress(offsets));
+	if (data_ptr == nullptr || offsets_ptr == nullptr) {
+		env->ThrowNew(J_SQLException, "Invalid string elements buffer");
+		return;
+	}
+	jlong data_cap = env->GetDirectBufferCapacity(data);
+	jlong offsets_cap = env->GetDirectBufferCapacity(offsets);
+	if (offsets_cap < 0 || static_cast<idx_t>(offsets_cap) < (cnt + 1) * sizeof(int32_t)) {
+		env->ThrowNew(J_SQLException, "String elements offsets buffer is too small");
+		return;
+	}
+
+	// validate all the offsets before the vector is modified
+	const idx_t inline_length = sizeof(duckdb_string_t::value.inlined.inlined);
+	bool all_inlined = true;
+	for (idx_t i = 0; i < cnt; i++) {
+		int32_t begin = offsets_ptr[i];
+		int32_t end = offsets_ptr[i + 1];
+		if (begin < 0 || end < begin || end > data_cap) {
+			env->ThrowNew(J_SQLException, "Invalid string elements offsets");
+			return;
+		}
+		if (static_cast<idx_t>(end - begin) > inline_length) {
+			all_inlined = false;
+		}
+	}
+
+	duckdb_logical_type vec_type = duckdb_vector_get_column_type(vec);
+	duckdb_type type_id = duckdb_get_type_id(vec_type);
+	duckdb_destroy_logical_type(&vec_type);
+	if (type_id != DUCKDB_TYPE_VARCHAR && type_id != DUCKDB_TYPE_BLOB) {
+		env->ThrowNew(J_SQLException, "String elements can only be assigned to VARCHAR or BLOB vectors");
+		return;
+	}
+
+	auto strings = reinterpret_cast<duckdb_string_t *>(duckdb_vector_get_data(vec)) + start;
+
+	// the data of all the strings is added to the vector string heap with a single allocation: it is assigned to the
+	// first element, then the strings that cannot be inlined point into its copy
+	char *heap_ptr = nullptr;
+	if (!all_inlined) {
+		idx_t total_size = static_cast<idx_t>(offsets_ptr[cnt] - offsets_ptr[0]);
+		duckdb_vector_assign_string_element_len(vec, start, data_ptr + offsets_ptr[0], total_size);
+		heap_ptr = strings[0].value.pointer.ptr;
+	}
+
+	for (idx_t i = 0; i < cnt; i++) {
+		const char *str_ptr = data_ptr + offsets_ptr[i];
+		auto len = static_cast<uint32_t>(offsets_ptr[i + 1] - offsets_ptr[i]);
+		auto &str = strings[i];
+		str.value.inlined.length = len;
+		if (len <= inline_length) {
+			std::memset(str.value.inlined.inlined, 0, inline_length);
+			std::memcpy(str.value.inlined.inlined, str_ptr, len);
+		} else {
+			std::memcpy(str.value.pointer.prefix, str_ptr, sizeof(str.value.pointer.prefix));
+			str.value.pointer.ptr = heap_ptr + (offsets_ptr[i] - offsets_ptr[0]);
+		}
+	}
+}
+
 /*
  * Class:     org_duckdb_DuckDBBindings
  * Method:    duckdb_list_vector_get_child
@@ -89,6 +89,18 @@ std::unique_ptr<duckdb::DBConfig> create_db_config(JNIEnv *env, jboolean read_on
 	    "jdbc_stream_results",
 	    "Whether to stream results. Only one ResultSet on a connection can be open at once when true",
 	    duckdb::LogicalType::BOOLEAN);
+	config->AddExtensionOption("jdbc_prefetch_chunks",
+	                           "Number of chunks of a streaming result to fetch in background while the previous "
+	                           "chunks are consumed, 0 disables prefetching",
+	                           duckdb::LogicalType::UBIGINT, duckdb::Value::UBIGINT(0));
+	config->AddExtensionOption("jdbc_prefetch_buffer_size",
+	                           "Maximum memory in bytes used by the prefetched chunks of a streaming result, "
+	                           "0 means no limit",
+	                           duckdb::LogicalType::UBIGINT, duckdb::Value::UBIGINT(0));
+	config->AddExtensionOption("jdbc_statement_cache_size",
+	                           "Number of prepared statement plans cached per connection and reused when the same "
+	                           "SQL is prepared again, 0 disables the cache",
+	                           duckdb::LogicalType::UBIGINT, duckdb::Value::UBIGINT(0));
 	if (read_only) {
 		config->options.access_mode = duckdb::AccessMode::READ_ONLY;
 	}
@@ -1,9 +1,11 @@
 extern "C" {
 #include "duckdb.h"
 }
+#include "arrow_query_stream.hpp"
 #include "config.hpp"
 #include "duckdb.hpp"
 #include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/common/arrow/physical_arrow_collector.hpp"
 #include "duckdb/common/arrow/result_arrow_wrapper.hpp"
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/common/shared_ptr.hpp"
@@ -14,9 +16,15 @@ extern "C" {
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/db_instance_cache.hpp"
 #include "duckdb/main/extension/extension_loader.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/parser/expression/constant_expression.hpp"
+#include "duckdb/parser/expression/parameter_expression.hpp"
 #include "duckdb/parser/parsed_data/create_type_info.hpp"
+#include "duckdb/parser/statement/insert_statement.hpp"
+#include "duckdb/parser/tableref/expressionlistref.hpp"
 #include "functions.hpp"
 #include "holders.hpp"
+#include "jdbc_appender.hpp"
 #include "refs.hpp"
 #include "types.hpp"
 #include "util.hpp"
@@ -190,14 +198,33 @@ void _duckdb_jdbc_disconnect(JNIEnv *env, jclass, jobject conn_ref_buf) {
 
 #include "utf8proc_wrapper.hpp"
 
+static idx_t get_ubigint_setting(ClientContext &context, const string &name) {
+	Value result;
+	if (!context.TryGetCurrentSetting(name, result) || result.IsNull()) {
+		return 0;
+	}
+	return result.GetValue<uint64_t>();
+}
+
 jobject _duckdb_jdbc_prepare(JNIEnv *env, jclass, jobject conn_ref_buf, jbyteArray query_j) {
 	auto conn_ref = get_connection(env, conn_ref_buf);
 	if (!conn_ref) {
 		return nullptr;
 	}
+	auto &statement_cache = get_connection_ref(env, conn_ref_buf)->statement_cache;
 
 	auto query = jbyteArray_to_string(env, query_j);
 
+	idx_t cache_size = get_ubigint_setting(*conn_ref->context, "jdbc_statement_cache_size");
+	if (cache_size > 0) {
+		auto cached = statement_cache.Get(*conn_ref->context, query);
+		if (cached) {
+			auto stmt_ref = new StatementHolder();
+			stmt_ref->stmt = std::move(cached);
+			return env->NewDirectByteBuffer(stmt_ref, 0);
+		}
+	}
+
 	auto statements = conn_ref->ExtractStatements(query.c_str());
 	if (statements.empty()) {
 		throw InvalidInputException("No statements to execute.");
@@ -206,6 +233,9 @@ jobject _duckdb_jdbc_prepare(JNIEnv *env, jclass, jobject conn_ref_buf, jbyteArr
 	// if there are multiple statements, we directly execute the statements besides the last one
 	// we only return the result of the last statement to the user, unless one of the previous statements fails
 	for (idx_t i = 0; i + 1 < statements.size(); i++) {
+		if (StatementCache::ChangesBinding(statements[i]->type)) {
+			StatementCache::InvalidateAll(*conn_ref->context);
+		}
 		auto res = conn_ref->Query(std::move(statements[i]));
 		if (res->HasError()) {
 			res->ThrowError();
@@ -225,17 +255,85 @@ jobject _duckdb_jdbc_prepare(JNIEnv *env, jclass, jobject conn_ref_buf, jbyteArr
 		// Just return control flow back to JVM, as an Exception is pending anyway
 		return nullptr;
 	}
+	// the previous statements of a multi-statement query are executed on every prepare, it is never cached
+	if (cache_size > 0 && statements.size() == 1) {
+		statement_cache.Put(*conn_ref->context, query, *stmt_ref->stmt, cache_size);
+	}
 	return env->NewDirectByteBuffer(stmt_ref, 0);
 }
 
-jobject _duckdb_jdbc_execute(JNIEnv *env, jclass, jobject stmt_ref_buf, jobjectArray params) {
+// Type tags of the parameters passed from DuckDBParameters
+enum class ParamType : jbyte { OBJECT = 0, BOOLEAN, TINYINT, SMALLINT, INTEGER, BIGINT, FLOAT, DOUBLE };
+
+/**
+ * Creates the value of a parameter passed unboxed from Java, no calls back into JVM are needed for it.
+ */
+static Value primitive_param_to_value(ParamType type, int64_t bits) {
+	switch (type) {
+	case ParamType::BOOLEAN:
+		return Value::BOOLEAN(bits != 0);
+	case ParamType::TINYINT:
+		return Value::TINYINT(static_cast<int8_t>(bits));
+	case ParamType::SMALLINT:
+		return Value::SMALLINT(static_cast<int16_t>(bits));
+	case ParamType::INTEGER:
+		return Value::INTEGER(static_cast<int32_t>(bits));
+	case ParamType::BIGINT:
+		return Value::BIGINT(bits);
+	case ParamType::FLOAT: {
+		auto int_bits = static_cast<int32_t>(bits);
+		float val;
+		memcpy(&val, &int_bits, sizeof(float));
+		return Value::FLOAT(val);
+	}
+	case ParamType::DOUBLE: {
+		double val;
+		memcpy(&val, &bits, sizeof(double));
+		return Value::DOUBLE(val);
+	}
+	default:
+		throw InvalidInputException("Unsupported parameter type tag: %d", static_cast<int>(type));
+	}
+}
+
+/**
+ * Converts count parameters passed from one or more DuckDBParameters to DuckDB values.
+ */
+static duckdb::vector<Value> params_to_values(JNIEnv *env, ClientContext &context, jobjectArray params,
+                                              jbyteArray param_types_j, jlongArray param_values_j, idx_t count) {
+	duckdb::vector<Value> values;
+	if (count == 0) {
+		return values;
+	}
+	duckdb::vector<jbyte> param_types(count);
+	duckdb::vector<jlong> param_values(count);
+	env->GetByteArrayRegion(param_types_j, 0, count, param_types.data());
+	env->GetLongArrayRegion(param_values_j, 0, count, param_values.data());
+	if (env->ExceptionCheck()) {
+		throw InvalidInputException("Invalid parameters arrays");
+	}
+	values.reserve(count);
+	for (idx_t i = 0; i < count; i++) {
+		auto type = static_cast<ParamType>(param_types[i]);
+		if (type != ParamType::OBJECT) {
+			values.push_back(primitive_param_to_value(type, param_values[i]));
+			continue;
+		}
+		auto param = env->GetObjectArrayElement(params, i);
+		values.push_back(to_duckdb_value(env, param, context));
+		env->DeleteLocalRef(param);
+	}
+	return values;
+}
+
+jobject _duckdb_jdbc_execute(JNIEnv *env, jclass, jobject stmt_ref_buf, jobjectArray params,
+                             jbyteArray param_types_j, jlongArray param_values_j) {
 	auto stmt_ref = (StatementHolder *)env->GetDirectBufferAddress(stmt_ref_buf);
 	if (!stmt_ref) {
 		throw InvalidInputException("Invalid statement");
 	}
 
 	auto res_ref = make_uniq<ResultHolder>();
-	duckdb::vector<Value> duckdb_params;
 
 	idx_t param_len = env->GetArrayLength(params);
 
@@ -244,19 +342,17 @@ jobject _duckdb_jdbc_execute(JNIEnv *env, jclass, jobject stmt_ref_buf, jobjectA
 	}
 
 	auto &context = stmt_ref->stmt->context;
-
-	if (param_len > 0) {
-		for (idx_t i = 0; i < param_len; i++) {
-			auto param = env->GetObjectArrayElement(params, i);
-			duckdb::Value val = to_duckdb_value(env, param, *context);
-			duckdb_params.push_back(std::move(val));
-		}
-	}
+	auto duckdb_params = params_to_values(env, *context, params, param_types_j, param_values_j, param_len);
 
 	Value result;
 	bool stream_results =
 	    stmt_ref->stmt->context->TryGetCurrentSetting("jdbc_stream_results", result) ? result.GetValue<bool>() : false;
 
+	if (stream_results) {
+		res_ref->prefetch_chunks = get_ubigint_setting(*context, "jdbc_prefetch_chunks");
+		res_ref->prefetch_buffer_size = get_ubigint_setting(*context, "jdbc_prefetch_buffer_size");
+	}
+
 	res_ref->res = stmt_ref->stmt->Execute(duckdb_params, stream_results);
 	if (res_ref->res->HasError()) {
 		std::string error_msg = std::string(res_ref->res->GetError());
@@ -269,6 +365,134 @@ jobject _duckdb_jdbc_execute(JNIEnv *env, jclass, jobject stmt_ref_buf, jobjectA
 	return env->NewDirectByteBuffer(res_ref.release(), 0);
 }
 
+// Returned in the update counts of a batch when the number of rows changed by its entry is unknown,
+// same as java.sql.Statement.SUCCESS_NO_INFO
+static constexpr int64_t BATCH_SUCCESS_NO_INFO = -2;
+
+static int64_t get_changed_rows(QueryResult &result) {
+	if (result.properties.return_type != StatementReturnType::CHANGED_ROWS ||
+	    result.type != QueryResultType::MATERIALIZED_RESULT) {
+		return -1;
+	}
+	auto &materialized = result.Cast<MaterializedQueryResult>();
+	if (materialized.RowCount() == 0) {
+		return -1;
+	}
+	return materialized.GetValue(0, 0).GetValue<int64_t>();
+}
+
+/**
+ * Checks whether the prepared statement is a plain "INSERT INTO tbl VALUES (?, ...)" that only inserts
+ * its parameters. Such statement can be executed for a whole batch at once by replacing its single
+ * VALUES row with the rows of the batch. Returns the indexes of the parameters in the VALUES row order,
+ * or an empty vector if the statement is not eligible.
+ */
+static duckdb::vector<idx_t> get_batch_insert_params(PreparedStatement &stmt) {
+	duckdb::vector<idx_t> param_idxs;
+	if (!stmt.data || !stmt.data->unbound_statement ||
+	    stmt.data->unbound_statement->type != StatementType::INSERT_STATEMENT) {
+		return param_idxs;
+	}
+	auto &insert = stmt.data->unbound_statement->Cast<InsertStatement>();
+	if (!insert.returning_list.empty() || insert.on_conflict_info || insert.default_values ||
+	    !insert.cte_map.map.empty()) {
+		return param_idxs;
+	}
+	auto values_list = insert.GetValuesList();
+	if (!values_list || values_list->values.size() != 1) {
+		return param_idxs;
+	}
+	for (auto &expr : values_list->values[0]) {
+		if (expr->GetExpressionType() != ExpressionType::VALUE_PARAMETER) {
+			return duckdb::vector<idx_t>();
+		}
+		// positional parameters are bound by their 1-based index, see PreparedStatement::PendingQuery
+		auto &identifier = expr->Cast<ParameterExpression>().identifier;
+		idx_t param_number;
+		if (!TryCast::Operation<string_t, idx_t>(string_t(identifier), param_number) || param_number == 0 ||
+		    param_number > stmt.named_param_map.size()) {
+			return duckdb::vector<idx_t>();
+		}
+		param_idxs.push_back(param_number - 1);
+	}
+	return param_idxs;
+}
+
+/**
+ * Executes the batch as a sequence of multi-row INSERT statements, each inserting up to
+ * STANDARD_VECTOR_SIZE batch entries. The values are stored column-wise, value of parameter p
+ * in the entry r is at values[p * row_count + r].
+ */
+static void execute_batch_insert(PreparedStatement &stmt, const duckdb::vector<idx_t> &param_idxs,
+                                 duckdb::vector<Value> &values, idx_t row_count, duckdb::vector<int64_t> &counts) {
+	for (idx_t offset = 0; offset < row_count; offset += STANDARD_VECTOR_SIZE) {
+		auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, row_count - offset);
+		auto statement = stmt.data->unbound_statement->Copy();
+		statement->named_param_map.clear();
+		auto &values_list = *statement->Cast<InsertStatement>().GetValuesList();
+		values_list.values.clear();
+		for (idx_t row_idx = offset; row_idx < offset + count; row_idx++) {
+			duckdb::vector<duckdb::unique_ptr<ParsedExpression>> row;
+			for (auto param_idx : param_idxs) {
+				row.push_back(make_uniq<ConstantExpression>(values[param_idx * row_count + row_idx]));
+			}
+			values_list.values.push_back(std::move(row));
+		}
+
+		auto result = stmt.context->Query(std::move(statement), false);
+		if (result->HasError()) {
+			result->ThrowError();
+		}
+		// every entry inserts exactly one row, unless the table has a rule that silently drops rows
+		auto entry_count = get_changed_rows(*result) == static_cast<int64_t>(count) ? 1 : BATCH_SUCCESS_NO_INFO;
+		for (idx_t row_idx = offset; row_idx < offset + count; row_idx++) {
+			counts[row_idx] = entry_count;
+		}
+	}
+}
+
+jlongArray _duckdb_jdbc_execute_batch(JNIEnv *env, jclass, jobject stmt_ref_buf, jobjectArray params,
+                                      jbyteArray param_types_j, jlongArray param_values_j, jint row_count_j) {
+	auto stmt_ref = (StatementHolder *)env->GetDirectBufferAddress(stmt_ref_buf);
+	if (!stmt_ref) {
+		throw InvalidInputException("Invalid statement");
+	}
+	auto &stmt = *stmt_ref->stmt;
+	auto row_count = NumericCast<idx_t>(row_count_j);
+	auto param_count = stmt.named_param_map.size();
+	idx_t values_len = env->GetArrayLength(params);
+	if (values_len != param_count * row_count) {
+		throw InvalidInputException("Parameter count mismatch");
+	}
+
+	auto values = params_to_values(env, *stmt.context, params, param_types_j, param_values_j, values_len);
+	duckdb::vector<int64_t> counts(row_count);
+
+	auto insert_param_idxs = get_batch_insert_params(stmt);
+	if (!insert_param_idxs.empty()) {
+		execute_batch_insert(stmt, insert_param_idxs, values, row_count, counts);
+	} else {
+		duckdb::vector<Value> row_values(param_count);
+		for (idx_t row_idx = 0; row_idx < row_count; row_idx++) {
+			for (idx_t param_idx = 0; param_idx < param_count; param_idx++) {
+				row_values[param_idx] = std::move(values[param_idx * row_count + row_idx]);
+			}
+			auto result = stmt.Execute(row_values, false);
+			if (result->HasError()) {
+				result->ThrowError();
+			}
+			counts[row_idx] = get_changed_rows(*result);
+		}
+	}
+
+	auto counts_j = env->NewLongArray(row_count);
+	if (counts_j == nullptr) {
+		return nullptr;
+	}
+	env->SetLongArrayRegion(counts_j, 0, row_count, reinterpret_cast<const jlong *>(counts.data()));
+	return counts_j;
+}
+
 void _duckdb_jdbc_release(JNIEnv *env, jclass, jobject stmt_ref_buf) {
 	if (nullptr == stmt_ref_buf) {
 		return;
@@ -370,9 +594,48 @@ jobject _duckdb_jdbc_prepared_statement_meta(JNIEnv *env, jclass, jobject stmt_r
 
 jobject ProcessVector(JNIEnv *env, Connection *conn_ref, Vector &vec, idx_t row_count);
 
-jobjectArray _duckdb_jdbc_fetch(JNIEnv *env, jclass, jobject res_ref_buf, jobject conn_ref_buf) {
+static duckdb::unique_ptr<DataChunk> fetch_next_chunk(ResultHolder &res_ref) {
+	if (!res_ref.prefetcher && res_ref.prefetch_chunks > 0 && res_ref.res->type == QueryResultType::STREAM_RESULT) {
+		res_ref.prefetcher =
+		    make_uniq<ResultPrefetcher>(*res_ref.res, res_ref.prefetch_chunks, res_ref.prefetch_buffer_size);
+	}
+	if (res_ref.prefetcher) {
+		return res_ref.prefetcher->Fetch();
+	}
+	auto chunk = res_ref.res->Fetch();
+	if (!chunk && res_ref.res->HasError()) {
+		// the query failed while streaming, do not report the rows fetched so far as the complete result
+		res_ref.res->ThrowError();
+	}
+	return chunk;
+}
+
+/**
+ * Concatenates the next result chunks until at least fetch_size rows are collected or the result is
+ * exhausted, so that all these rows are passed to Java with a single set of column vectors.
+ */
+static duckdb::unique_ptr<DataChunk> fetch_rows(ResultHolder &res_ref, idx_t fetch_size) {
+	auto chunk = fetch_next_chunk(res_ref);
+	if (!chunk || chunk->size() == 0 || chunk->size() >= fetch_size) {
+		return chunk;
+	}
+	auto batch = make_uniq<DataChunk>();
+	batch->Initialize(Allocator::DefaultAllocator(), chunk->GetTypes());
+	batch->Append(*chunk, true);
+	while (batch->size() < fetch_size) {
+		chunk = fetch_next_chunk(res_ref);
+		if (!chunk || chunk->size() == 0) {
+			break;
+		}
+		batch->Append(*chunk, true);
+	}
+	return batch;
+}
+
+jobjectArray _duckdb_jdbc_fetch(JNIEnv *env, jclass, jobject res_ref_buf, jobject conn_ref_buf, jint fetch_size) {
 	auto res_ref = (ResultHolder *)env->GetDirectBufferAddress(res_ref_buf);
-	if (!res_ref || !res_ref->res || res_ref->res->HasError()) {
+	// while prefetching, errors of the result are rethrown by the prefetcher
+	if (!res_ref || !res_ref->res || (!res_ref->prefetcher && res_ref->res->HasError())) {
 		throw InvalidInputException("Invalid result set");
 	}
 
@@ -381,7 +644,13 @@ jobjectArray _duckdb_jdbc_fetch(JNIEnv *env, jclass, jobject res_ref_buf, jobjec
 		return nullptr;
 	}
 
-	res_ref->chunk = res_ref->res->Fetch();
+	// release the rows passed to Java before, with large fetch sizes they can take significant memory
+	res_ref->chunk.reset();
+	if (fetch_size > STANDARD_VECTOR_SIZE) {
+		res_ref->chunk = fetch_rows(*res_ref, NumericCast<idx_t>(fetch_size));
+	} else {
+		res_ref->chunk = fetch_next_chunk(*res_ref);
+	}
 	if (!res_ref->chunk) {
 		res_ref->chunk = make_uniq<DataChunk>();
 	}
@@ -399,20 +668,78 @@ jobjectArray _duckdb_jdbc_fetch(JNIEnv *env, jclass, jobject res_ref_buf, jobjec
 	return vec_array;
 }
 
-jobject ProcessVector(JNIEnv *env, Connection *conn_ref, Vector &vec, idx_t row_count) {
-	auto type_str = env->NewStringUTF(type_to_jduckdb_type(vec.GetType()).c_str());
-	// construct nullmask
-	auto null_array = env->NewBooleanArray(row_count);
-	jboolean *null_unique_array = env->GetBooleanArrayElements(null_array, nullptr);
+/**
+ * Exports all strings of a VARCHAR or BLOB vector as a single byte array plus an offsets array with
+ * (row_count + 1) entries, string for row i is stored at [offsets[i], offsets[i + 1]). NULL rows are
+ * stored as empty strings. This takes a constant number of JNI calls per vector, decoding into
+ * Java Strings is done lazily on Java side.
+ */
+static void process_string_vector(JNIEnv *env, Vector &vec, idx_t row_count, jbyteArray &string_data,
+                                  jintArray &string_offsets) {
+	auto strings = FlatVector::GetData<string_t>(vec);
+	auto &validity = FlatVector::Validity(vec);
+
+	idx_t total_size = 0;
 	for (idx_t row_idx = 0; row_idx < row_count; row_idx++) {
-		null_unique_array[row_idx] = FlatVector::IsNull(vec, row_idx);
+		if (validity.RowIsValid(row_idx)) {
+			total_size += strings[row_idx].GetSize();
+		}
+	}
+	if (total_size > static_cast<idx_t>(std::numeric_limits<jint>::max())) {
+		throw InvalidInputException("String data size of a single vector exceeds the maximum Java array size");
+	}
+
+	string_data = env->NewByteArray(static_cast<jsize>(total_size));
+	string_offsets = env->NewIntArray(static_cast<jsize>(row_count + 1));
+	if (string_data == nullptr || string_offsets == nullptr) {
+		throw InvalidInputException("Cannot allocate string data arrays");
+	}
+
+	auto data_ptr = reinterpret_cast<char *>(env->GetPrimitiveArrayCritical(string_data, nullptr));
+	if (data_ptr == nullptr) {
+		throw InvalidInputException("Cannot access string data array");
+	}
+	auto offsets_ptr = reinterpret_cast<jint *>(env->GetPrimitiveArrayCritical(string_offsets, nullptr));
+	if (offsets_ptr == nullptr) {
+		env->ReleasePrimitiveArrayCritical(string_data, data_ptr, JNI_ABORT);
+		throw InvalidInputException("Cannot access string offsets array");
+	}
+
+	idx_t offset = 0;
+	for (idx_t row_idx = 0; row_idx < row_count; row_idx++) {
+		offsets_ptr[row_idx] = static_cast<jint>(offset);
+		if (!validity.RowIsValid(row_idx)) {
+			continue;
+		}
+		auto &d_str = strings[row_idx];
+		memcpy(data_ptr + offset, d_str.GetData(), d_str.GetSize());
+		offset += d_str.GetSize();
+	}
+	offsets_ptr[row_count] = static_cast<jint>(offset);
+
+	env->ReleasePrimitiveArrayCritical(string_offsets, offsets_ptr, 0);
+	env->ReleasePrimitiveArrayCritical(string_data, data_ptr, 0);
+}
+
+/**
+ * Returns a direct buffer over the 64-bit words of the vector validity mask, the buffer is only valid
+ * while the chunk is alive. Returns nullptr when all rows are valid.
+ */
+static jobject make_validity_buf(JNIEnv *env, Vector &vec, idx_t row_count) {
+	auto &validity = FlatVector::Validity(vec);
+	if (validity.CheckAllValid(row_count)) {
+		return nullptr;
 	}
-	env->ReleaseBooleanArrayElements(null_array, null_unique_array, 0);
+	return env->NewDirectByteBuffer(validity.GetData(), ValidityMask::ValidityMaskSize(row_count));
+}
 
-	auto jvec = env->NewObject(J_DuckVector, J_DuckVector_init, type_str, (int)row_count, null_array);
+jobject ProcessVector(JNIEnv *env, Connection *conn_ref, Vector &vec, idx_t row_count) {
+	auto type_str = env->NewStringUTF(type_to_jduckdb_type(vec.GetType()).c_str());
 
 	jobject constlen_data = nullptr;
 	jobjectArray varlen_data = nullptr;
+	jbyteArray string_data = nullptr;
+	jintArray string_offsets = nullptr;
 
 	switch (vec.GetType().id()) {
 	case LogicalTypeId::BOOLEAN:
@@ -524,23 +851,6 @@ jobject ProcessVector(JNIEnv *env, Connection *conn_ref, Vector &vec, idx_t row_
 
 		break;
 	}
-	case LogicalTypeId::BLOB:
-		varlen_data = env->NewObjectArray(row_count, J_ByteArray, nullptr);
-
-		for (idx_t row_idx = 0; row_idx < row_count; row_idx++) {
-			if (FlatVector::IsNull(vec, row_idx)) {
-				continue;
-			}
-			auto &d_str = ((string_t *)FlatVector::GetData(vec))[row_idx];
-
-			auto j_arr = env->NewByteArray(d_str.GetSize());
-			auto j_arr_el = env->GetByteArrayElements(j_arr, nullptr);
-			memcpy((void *)j_arr_el, (void *)d_str.GetData(), d_str.GetSize());
-			env->ReleaseByteArrayElements(j_arr, j_arr_el, 0);
-
-			env->SetObjectArrayElement(varlen_data, row_idx, j_arr);
-		}
-		break;
 	case LogicalTypeId::UUID:
 		constlen_data = env->NewDirectByteBuffer(FlatVector::GetData(vec), row_count * sizeof(hugeint_t));
 		break;
@@ -595,21 +905,20 @@ jobject ProcessVector(JNIEnv *env, Connection *conn_ref, Vector &vec, idx_t row_
 		vec.ReferenceAndSetType(string_vec);
 		// fall through on purpose
 	}
+	case LogicalTypeId::BLOB:
 	case LogicalTypeId::VARCHAR:
-		varlen_data = env->NewObjectArray(row_count, J_String, nullptr);
-		for (idx_t row_idx = 0; row_idx < row_count; row_idx++) {
-			if (FlatVector::IsNull(vec, row_idx)) {
-				continue;
-			}
-			auto d_str = ((string_t *)FlatVector::GetData(vec))[row_idx];
-			auto j_str = decode_charbuffer_to_jstring(env, d_str.GetData(), d_str.GetSize());
-			env->SetObjectArrayElement(varlen_data, row_idx, j_str);
-		}
+		process_string_vector(env, vec, row_count, string_data, string_offsets);
 		break;
 	}
 
+	// the validity mask is taken after the (possible) cast above, because the cast replaces the vector buffers
+	auto validity_buf = make_validity_buf(env, vec, row_count);
+	auto jvec = env->NewObject(J_DuckVector, J_DuckVector_init, type_str, (int)row_count, validity_buf);
+
 	env->SetObjectField(jvec, J_DuckVector_constlen, constlen_data);
 	env->SetObjectField(jvec, J_DuckVector_varlen, varlen_data);
+	env->SetObjectField(jvec, J_DuckVector_string_data, string_data);
+	env->SetObjectField(jvec, J_DuckVector_string_offsets, string_offsets);
 
 	return jvec;
 }
@@ -627,12 +936,12 @@ jobject _duckdb_jdbc_create_appender(JNIEnv *env, jclass, jobject conn_ref_buf,
 	}
 	auto schema_name = jbyteArray_to_string(env, schema_name_j);
 	auto table_name = jbyteArray_to_string(env, table_name_j);
-	auto appender = new Appender(*conn_ref, schema_name, table_name);
+	auto appender = new JdbcAppender(*conn_ref, schema_name, table_name);
 	return env->NewDirectByteBuffer(appender, 0);
 }
 
-static Appender *get_appender(JNIEnv *env, jobject appender_ref_buf) {
-	auto appender_ref = (Appender *)env->GetDirectBufferAddress(appender_ref_buf);
+static JdbcAppender *get_appender(JNIEnv *env, jobject appender_ref_buf) {
+	auto appender_ref = (JdbcAppender *)env->GetDirectBufferAddress(appender_ref_buf);
 	if (!appender_ref) {
 		throw InvalidInputException("Invalid appender");
 	}
@@ -719,6 +1028,189 @@ void _duckdb_jdbc_appender_append_null(JNIEnv *env, jclass, jobject appender_ref
 	get_appender(env, appender_ref_buf)->Append<std::nullptr_t>(nullptr);
 }
 
+void _duckdb_jdbc_appender_begin_columns(JNIEnv *env, jclass, jobject appender_ref_buf, jint row_count) {
+	if (row_count <= 0) {
+		throw InvalidInputException("Number of rows to append must be positive, got %d", row_count);
+	}
+	get_appender(env, appender_ref_buf)->BeginColumns(static_cast<idx_t>(row_count));
+}
+
+/**
+ * Marks as NULL the rows of the column append, for which the corresponding bit of the null mask
+ * is set. Bit (offset + i) of the mask corresponds to the row i, same as the values offset.
+ */
+static void apply_null_mask(JNIEnv *env, jlongArray null_mask_j, idx_t offset, idx_t count, Vector &vec) {
+	if (null_mask_j == nullptr) {
+		return;
+	}
+	idx_t first_word = offset / 64;
+	idx_t words_count = (offset + count + 63) / 64 - first_word;
+	if (first_word + words_count > static_cast<idx_t>(env->GetArrayLength(null_mask_j))) {
+		throw InvalidInputException("Null mask is too short for %llu rows at offset %llu", count, offset);
+	}
+	duckdb::vector<jlong> mask(words_count);
+	env->GetLongArrayRegion(null_mask_j, first_word, words_count, mask.data());
+	auto &validity = FlatVector::Validity(vec);
+	for (idx_t i = 0; i < count; i++) {
+		idx_t bit = offset + i;
+		if ((static_cast<uint64_t>(mask[bit / 64 - first_word]) >> (bit % 64)) & 1) {
+			validity.SetInvalid(i);
+		}
+	}
+}
+
+static jclass get_column_array_class(const LogicalType &type) {
+	if (type.id() == LogicalTypeId::ENUM) {
+		return nullptr;
+	}
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+		return J_BooleanArray;
+	case PhysicalType::INT8:
+	case PhysicalType::UINT8:
+		return J_ByteArray;
+	case PhysicalType::INT16:
+	case PhysicalType::UINT16:
+		return J_ShortArray;
+	case PhysicalType::INT32:
+	case PhysicalType::UINT32:
+		return J_IntArray;
+	case PhysicalType::INT64:
+	case PhysicalType::UINT64:
+		return J_LongArray;
+	case PhysicalType::FLOAT:
+		return J_FloatArray;
+	case PhysicalType::DOUBLE:
+		return J_DoubleArray;
+	default:
+		return nullptr;
+	}
+}
+
+/**
+ * Sets the values of a column of the started columns append from a primitive Java array or a direct
+ * ByteBuffer. Values are copied as is in the physical representation of the column type, e.g. unscaled
+ * values for DECIMAL columns or microseconds since epoch for TIMESTAMP columns.
+ */
+void _duckdb_jdbc_appender_append_column(JNIEnv *env, jclass, jobject appender_ref_buf, jint col_idx,
+                                         jobject values, jint offset_j, jlongArray null_mask) {
+	auto appender = get_appender(env, appender_ref_buf);
+	if (col_idx < 0 || offset_j < 0) {
+		throw InvalidInputException("Invalid column index %d or offset %d", col_idx, offset_j);
+	}
+	auto &vec = appender->GetColumn(static_cast<idx_t>(col_idx));
+	auto &type = vec.GetType();
+	auto array_class = get_column_array_class(type);
+	if (array_class == nullptr) {
+		throw InvalidInputException("Column %d of type %s cannot be appended from primitive values", col_idx,
+		                            type.ToString());
+	}
+	auto count = appender->ColumnsCount();
+	auto offset = static_cast<idx_t>(offset_j);
+	auto value_size = GetTypeIdSize(type.InternalType());
+	auto target = FlatVector::GetData(vec);
+
+	if (values != nullptr && env->IsInstanceOf(values, J_ByteBuffer)) {
+		auto address = reinterpret_cast<data_ptr_t>(env->GetDirectBufferAddress(values));
+		if (address == nullptr) {
+			throw InvalidInputException("Only direct ByteBuffers are supported for column values");
+		}
+		if ((offset + count) * value_size > static_cast<idx_t>(env->GetDirectBufferCapacity(values))) {
+			throw InvalidInputException("ByteBuffer is too small for %llu values at offset %llu", count, offset);
+		}
+		memcpy(target, address + offset * value_size, count * value_size);
+		if (type.InternalType() == PhysicalType::BOOL) {
+			for (idx_t i = 0; i < count; i++) {
+				target[i] = target[i] != 0;
+			}
+		}
+	} else if (values != nullptr && env->IsInstanceOf(values, array_class)) {
+		auto array = static_cast<jarray>(values);
+		if (offset + count > static_cast<idx_t>(env->GetArrayLength(array))) {
+			throw InvalidInputException("Array is too small for %llu values at offset %llu", count, offset);
+		}
+		auto source = reinterpret_cast<data_ptr_t>(env->GetPrimitiveArrayCritical(array, nullptr));
+		if (source == nullptr) {
+			throw InvalidInputException("Unable to access column values array");
+		}
+		memcpy(target, source + offset * value_size, count * value_size);
+		env->ReleasePrimitiveArrayCritical(array, source, JNI_ABORT);
+	} else {
+		throw InvalidInputException(
+		    "Values of column %d of type %s must be passed as a %s array or a direct ByteBuffer", col_idx,
+		    type.ToString(), TypeIdToString(type.InternalType()));
+	}
+
+	apply_null_mask(env, null_mask, offset, count, vec);
+	appender->MarkColumnSet(static_cast<idx_t>(col_idx));
+}
+
+/**
+ * Sets the values of a VARCHAR or BLOB column of the started columns append. Value of row i is stored in data
+ * at [offsets[offset + i], offsets[offset + i + 1]).
+ */
+void _duckdb_jdbc_appender_append_string_column(JNIEnv *env, jclass, jobject appender_ref_buf, jint col_idx,
+                                                jbyteArray data, jintArray offsets_j, jint offset_j,
+                                                jlongArray null_mask) {
+	auto appender = get_appender(env, appender_ref_buf);
+	if (col_idx < 0 || offset_j < 0) {
+		throw InvalidInputException("Invalid column index %d or offset %d", col_idx, offset_j);
+	}
+	auto &vec = appender->GetColumn(static_cast<idx_t>(col_idx));
+	auto type_id = vec.GetType().id();
+	if (type_id != LogicalTypeId::VARCHAR && type_id != LogicalTypeId::BLOB) {
+		throw InvalidInputException("Column %d of type %s cannot be appended from string data", col_idx,
+		                            vec.GetType().ToString());
+	}
+	if (data == nullptr || offsets_j == nullptr) {
+		throw InvalidInputException("String data and offsets must be specified");
+	}
+	auto count = appender->ColumnsCount();
+	auto offset = static_cast<idx_t>(offset_j);
+	if (offset + count + 1 > static_cast<idx_t>(env->GetArrayLength(offsets_j))) {
+		throw InvalidInputException("Offsets array is too small for %llu values at offset %llu", count, offset);
+	}
+	duckdb::vector<jint> offsets(count + 1);
+	env->GetIntArrayRegion(offsets_j, offset, count + 1, offsets.data());
+
+	apply_null_mask(env, null_mask, offset, count, vec);
+	auto &validity = FlatVector::Validity(vec);
+	auto data_len = env->GetArrayLength(data);
+	for (idx_t i = 0; i < count; i++) {
+		if (validity.RowIsValid(i) && (offsets[i] < 0 || offsets[i] > offsets[i + 1] || offsets[i + 1] > data_len)) {
+			throw InvalidInputException("Invalid string offsets for row %llu", i);
+		}
+	}
+
+	auto target = FlatVector::GetData<string_t>(vec);
+	auto source = reinterpret_cast<const char *>(env->GetPrimitiveArrayCritical(data, nullptr));
+	if (source == nullptr) {
+		throw InvalidInputException("Unable to access string data array");
+	}
+	idx_t invalid_row = DConstants::INVALID_INDEX;
+	for (idx_t i = 0; i < count; i++) {
+		if (!validity.RowIsValid(i)) {
+			continue;
+		}
+		auto str = source + offsets[i];
+		auto len = static_cast<idx_t>(offsets[i + 1] - offsets[i]);
+		if (type_id == LogicalTypeId::VARCHAR && !Utf8Proc::IsValid(str, len)) {
+			invalid_row = i;
+			break;
+		}
+		target[i] = StringVector::AddStringOrBlob(vec, str, len);
+	}
+	env->ReleasePrimitiveArrayCritical(data, const_cast<char *>(source), JNI_ABORT);
+	if (invalid_row != DConstants::INVALID_INDEX) {
+		throw InvalidInputException("Invalid UTF-8 string in row %llu", invalid_row);
+	}
+	appender->MarkColumnSet(static_cast<idx_t>(col_idx));
+}
+
+void _duckdb_jdbc_appender_end_columns(JNIEnv *env, jclass, jobject appender_ref_buf) {
+	get_appender(env, appender_ref_buf)->EndColumns();
+}
+
 jlong _duckdb_jdbc_arrow_stream(JNIEnv *env, jclass, jobject res_ref_buf, jlong batch_size) {
 	if (!res_ref_buf) {
 		throw InvalidInputException("Invalid result set");
@@ -727,11 +1219,75 @@ jlong _duckdb_jdbc_arrow_stream(JNIEnv *env, jclass, jobject res_ref_buf, jlong
 	if (!res_ref || !res_ref->res || res_ref->res->HasError()) {
 		throw InvalidInputException("Invalid result set");
 	}
+	if (res_ref->prefetcher) {
+		throw InvalidInputException("Cannot export a result set to Arrow after its chunks were prefetched");
+	}
 
 	auto wrapper = new ResultArrowArrayStreamWrapper(std::move(res_ref->res), batch_size);
 	return (jlong)&wrapper->stream;
 }
 
+/**
+ * Replaces the result collector of the client context for the lifetime of the guard.
+ */
+class ResultCollectorGuard {
+public:
+	ResultCollectorGuard(ClientContext &context, get_result_collector_t collector)
+	    : config(ClientConfig::GetConfig(context)), prev_collector(std::move(config.get_result_collector)) {
+		config.get_result_collector = std::move(collector);
+	}
+	~ResultCollectorGuard() {
+		config.get_result_collector = std::move(prev_collector);
+	}
+
+private:
+	ClientConfig &config;
+	get_result_collector_t prev_collector;
+};
+
+jlong _duckdb_jdbc_execute_arrow(JNIEnv *env, jclass, jobject stmt_ref_buf, jobjectArray params,
+                                 jbyteArray param_types_j, jlongArray param_values_j, jlong batch_size) {
+	auto stmt_ref = (StatementHolder *)env->GetDirectBufferAddress(stmt_ref_buf);
+	if (!stmt_ref) {
+		throw InvalidInputException("Invalid statement");
+	}
+	if (batch_size <= 0) {
+		throw InvalidInputException("Invalid Arrow batch size: %lld", static_cast<long long>(batch_size));
+	}
+
+	idx_t param_len = env->GetArrayLength(params);
+	if (param_len != stmt_ref->stmt->named_param_map.size()) {
+		throw InvalidInputException("Parameter count mismatch");
+	}
+
+	auto &context = *stmt_ref->stmt->context;
+	auto duckdb_params = params_to_values(env, context, params, param_types_j, param_values_j, param_len);
+
+	// Arrow arrays are appended by the sink of the pipeline, in parallel when the plan does not need to preserve
+	// the insertion order, instead of converting the materialized chunks on this thread
+	duckdb::unique_ptr<QueryResult> res;
+	{
+		auto arrow_batch_size = static_cast<idx_t>(batch_size);
+		ResultCollectorGuard guard(context, [arrow_batch_size](ClientContext &ctx,
+		                                                       PreparedStatementData &data) -> PhysicalOperator & {
+			return PhysicalArrowCollector::Create(ctx, data, arrow_batch_size);
+		});
+		res = stmt_ref->stmt->Execute(duckdb_params, false);
+	}
+	if (res->HasError()) {
+		jclass exc_type =
+		    duckdb::ExceptionType::INTERRUPT == res->GetErrorType() ? J_SQLTimeoutException : J_SQLException;
+		env->ThrowNew(exc_type, res->GetError().c_str());
+		return 0;
+	}
+	if (res->type != QueryResultType::ARROW_RESULT) {
+		throw InvalidInputException("Statement result cannot be exported to Arrow");
+	}
+
+	auto stream = new ArrowQueryStream(std::move(res));
+	return (jlong)&stream->stream;
+}
+
 class JavaArrowTabularStreamFactory {
 public:
 	JavaArrowTabularStreamFactory(ArrowArrayStream *stream_ptr_p) : stream_ptr(stream_ptr_p) {};
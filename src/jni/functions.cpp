@@ -163,9 +163,20 @@ JNIEXPORT jobject JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1prepared_1s
 	}
 }
 
-JNIEXPORT jobject JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1execute(JNIEnv * env, jclass param0, jobject param1, jobjectArray param2) {
+JNIEXPORT jobject JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1execute(JNIEnv * env, jclass param0, jobject param1, jobjectArray param2, jbyteArray param3, jlongArray param4) {
 	try {
-		return _duckdb_jdbc_execute(env, param0, param1, param2);
+		return _duckdb_jdbc_execute(env, param0, param1, param2, param3, param4);
+	} catch (const std::exception &e) {
+		duckdb::ErrorData error(e);
+		ThrowJNI(env, error.Message().c_str());
+
+		return nullptr;
+	}
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1execute_1batch(JNIEnv * env, jclass param0, jobject param1, jobjectArray param2, jbyteArray param3, jlongArray param4, jint param5) {
+	try {
+		return _duckdb_jdbc_execute_batch(env, param0, param1, param2, param3, param4, param5);
 	} catch (const std::exception &e) {
 		duckdb::ErrorData error(e);
 		ThrowJNI(env, error.Message().c_str());
@@ -184,9 +195,9 @@ JNIEXPORT void JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1free_1result(J
 	}
 }
 
-JNIEXPORT jobjectArray JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1fetch(JNIEnv * env, jclass param0, jobject param1, jobject param2) {
+JNIEXPORT jobjectArray JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1fetch(JNIEnv * env, jclass param0, jobject param1, jobject param2, jint param3) {
 	try {
-		return _duckdb_jdbc_fetch(env, param0, param1, param2);
+		return _duckdb_jdbc_fetch(env, param0, param1, param2, param3);
 	} catch (const std::exception &e) {
 		duckdb::ErrorData error(e);
 		ThrowJNI(env, error.Message().c_str());
@@ -217,6 +228,17 @@ JNIEXPORT jlong JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1arrow_1stream
 	}
 }
 
+JNIEXPORT jlong JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1execute_1arrow(JNIEnv * env, jclass param0, jobject param1, jobjectArray param2, jbyteArray param3, jlongArray param4, jlong param5) {
+	try {
+		return _duckdb_jdbc_execute_arrow(env, param0, param1, param2, param3, param4, param5);
+	} catch (const std::exception &e) {
+		duckdb::ErrorData error(e);
+		ThrowJNI(env, error.Message().c_str());
+
+		return -1;
+	}
+}
+
 JNIEXPORT void JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1arrow_1register(JNIEnv * env, jclass param0, jobject param1, jlong param2, jbyteArray param3) {
 	try {
 		return _duckdb_jdbc_arrow_register(env, param0, param1, param2, param3);
@@ -418,6 +440,46 @@ JNIEXPORT void JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1appender_1appe
 	}
 }
 
+JNIEXPORT void JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1appender_1begin_1columns(JNIEnv * env, jclass param0, jobject param1, jint param2) {
+	try {
+		return _duckdb_jdbc_appender_begin_columns(env, param0, param1, param2);
+	} catch (const std::exception &e) {
+		duckdb::ErrorData error(e);
+		ThrowJNI(env, error.Message().c_str());
+
+	}
+}
+
+JNIEXPORT void JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1appender_1append_1column(JNIEnv * env, jclass param0, jobject param1, jint param2, jobject param3, jint param4, jlongArray param5) {
+	try {
+		return _duckdb_jdbc_appender_append_column(env, param0, param1, param2, param3, param4, param5);
+	} catch (const std::exception &e) {
+		duckdb::ErrorData error(e);
+		ThrowJNI(env, error.Message().c_str());
+
+	}
+}
+
+JNIEXPORT void JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1appender_1append_1string_1column(JNIEnv * env, jclass param0, jobject param1, jint param2, jbyteArray param3, jintArray param4, jint param5, jlongArray param6) {
+	try {
+		return _duckdb_jdbc_appender_append_string_column(env, param0, param1, param2, param3, param4, param5, param6);
+	} catch (const std::exception &e) {
+		duckdb::ErrorData error(e);
+		ThrowJNI(env, error.Message().c_str());
+
+	}
+}
+
+JNIEXPORT void JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1appender_1end_1columns(JNIEnv * env, jclass param0, jobject param1) {
+	try {
+		return _duckdb_jdbc_appender_end_columns(env, param0, param1);
+	} catch (const std::exception &e) {
+		duckdb::ErrorData error(e);
+		ThrowJNI(env, error.Message().c_str());
+
+	}
+}
+
 JNIEXPORT void JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1create_1extension_1type(JNIEnv * env, jclass param0, jobject param1) {
 	try {
 		return _duckdb_jdbc_create_extension_type(env, param0, param1);
@@ -69,17 +69,21 @@ jobject _duckdb_jdbc_prepared_statement_meta(JNIEnv * env, jclass param0, jobjec
 
 JNIEXPORT jobject JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1prepared_1statement_1meta(JNIEnv * env, jclass param0, jobject param1);
 
-jobject _duckdb_jdbc_execute(JNIEnv * env, jclass param0, jobject param1, jobjectArray param2);
+jobject _duckdb_jdbc_execute(JNIEnv * env, jclass param0, jobject param1, jobjectArray param2, jbyteArray param3, jlongArray param4);
 
-JNIEXPORT jobject JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1execute(JNIEnv * env, jclass param0, jobject param1, jobjectArray param2);
+JNIEXPORT jobject JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1execute(JNIEnv * env, jclass param0, jobject param1, jobjectArray param2, jbyteArray param3, jlongArray param4);
+
+jlongArray _duckdb_jdbc_execute_batch(JNIEnv * env, jclass param0, jobject param1, jobjectArray param2, jbyteArray param3, jlongArray param4, jint param5);
+
+JNIEXPORT jlongArray JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1execute_1batch(JNIEnv * env, jclass param0, jobject param1, jobjectArray param2, jbyteArray param3, jlongArray param4, jint param5);
 
 void _duckdb_jdbc_free_result(JNIEnv * env, jclass param0, jobject param1);
 
 JNIEXPORT void JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1free_1result(JNIEnv * env, jclass param0, jobject param1);
 
-jobjectArray _duckdb_jdbc_fetch(JNIEnv * env, jclass param0, jobject param1, jobject param2);
+jobjectArray _duckdb_jdbc_fetch(JNIEnv * env, jclass param0, jobject param1, jobject param2, jint param3);
 
-JNIEXPORT jobjectArray JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1fetch(JNIEnv * env, jclass param0, jobject param1, jobject param2);
+JNIEXPORT jobjectArray JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1fetch(JNIEnv * env, jclass param0, jobject param1, jobject param2, jint param3);
 
 jint _duckdb_jdbc_fetch_size(JNIEnv * env, jclass param0);
 
@@ -89,6 +93,10 @@ jlong _duckdb_jdbc_arrow_stream(JNIEnv * env, jclass param0, jobject param1, jlo
 
 JNIEXPORT jlong JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1arrow_1stream(JNIEnv * env, jclass param0, jobject param1, jlong param2);
 
+jlong _duckdb_jdbc_execute_arrow(JNIEnv * env, jclass param0, jobject param1, jobjectArray param2, jbyteArray param3, jlongArray param4, jlong param5);
+
+JNIEXPORT jlong JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1execute_1arrow(JNIEnv * env, jclass param0, jobject param1, jobjectArray param2, jbyteArray param3, jlongArray param4, jlong param5);
+
 void _duckdb_jdbc_arrow_register(JNIEnv * env, jclass param0, jobject param1, jlong param2, jbyteArray param3);
 
 JNIEXPORT void JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1arrow_1register(JNIEnv * env, jclass param0, jobject param1, jlong param2, jbyteArray param3);
@@ -169,6 +177,22 @@ void _duckdb_jdbc_appender_append_null(JNIEnv * env, jclass param0, jobject para
 
 JNIEXPORT void JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1appender_1append_1null(JNIEnv * env, jclass param0, jobject param1);
 
+void _duckdb_jdbc_appender_begin_columns(JNIEnv * env, jclass param0, jobject param1, jint param2);
+
+JNIEXPORT void JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1appender_1begin_1columns(JNIEnv * env, jclass param0, jobject param1, jint param2);
+
+void _duckdb_jdbc_appender_append_column(JNIEnv * env, jclass param0, jobject param1, jint param2, jobject param3, jint param4, jlongArray param5);
+
+JNIEXPORT void JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1appender_1append_1column(JNIEnv * env, jclass param0, jobject param1, jint param2, jobject param3, jint param4, jlongArray param5);
+
+void _duckdb_jdbc_appender_append_string_column(JNIEnv * env, jclass param0, jobject param1, jint param2, jbyteArray param3, jintArray param4, jint param5, jlongArray param6);
+
+JNIEXPORT void JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1appender_1append_1string_1column(JNIEnv * env, jclass param0, jobject param1, jint param2, jbyteArray param3, jintArray param4, jint param5, jlongArray param6);
+
+void _duckdb_jdbc_appender_end_columns(JNIEnv * env, jclass param0, jobject param1);
+
+JNIEXPORT void JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1appender_1end_1columns(JNIEnv * env, jclass param0, jobject param1);
+
 void _duckdb_jdbc_create_extension_type(JNIEnv * env, jclass param0, jobject param1);
 
 JNIEXPORT void JNICALL Java_org_duckdb_DuckDBNative_duckdb_1jdbc_1create_1extension_1type(JNIEnv * env, jclass param0, jobject param1);
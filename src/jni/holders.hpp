@@ -5,6 +5,8 @@ extern "C" {
 }
 #include "duckdb.hpp"
 #include "refs.hpp"
+#include "result_prefetcher.hpp"
+#include "statement_cache.hpp"
 
 #include <jni.h>
 
@@ -32,6 +34,8 @@ struct DBHolder {
 struct ConnectionHolder {
 	const duckdb::shared_ptr<duckdb::DuckDB> db;
 	const duckdb::unique_ptr<duckdb::Connection> connection;
+	//! Used when jdbc_statement_cache_size is set
+	StatementCache statement_cache;
 
 	ConnectionHolder(duckdb::shared_ptr<duckdb::DuckDB> _db)
 	    : db(_db), connection(duckdb::make_uniq<duckdb::Connection>(*_db)) {
@@ -49,6 +53,12 @@ struct StatementHolder {
 struct ResultHolder {
 	duckdb::unique_ptr<duckdb::QueryResult> res;
 	duckdb::unique_ptr<duckdb::DataChunk> chunk;
+	//! Number of chunks to prefetch in background for streaming results, 0 disables prefetching
+	idx_t prefetch_chunks = 0;
+	//! Memory limit for the prefetched chunks in bytes, 0 means no limit
+	idx_t prefetch_buffer_size = 0;
+	//! Started on the first fetch, must be declared after (destroyed before) the result it reads from
+	duckdb::unique_ptr<ResultPrefetcher> prefetcher;
 };
 
 inline ConnectionHolder *get_connection_ref(JNIEnv *env, jobject conn_ref_buf) {
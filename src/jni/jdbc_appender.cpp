@@ -0,0 +1,88 @@
+#include "jdbc_appender.hpp"
+
+#include "duckdb/storage/storage_info.hpp"
+
+using namespace duckdb;
+
+JdbcAppender::JdbcAppender(Connection &con, const std::string &schema_name, const std::string &table_name)
+    : Appender(con, schema_name, table_name) {
+}
+
+void JdbcAppender::BeginColumns(idx_t count) {
+	if (column != 0) {
+		throw InvalidInputException("Cannot append columns in the middle of a row");
+	}
+	if (count == 0) {
+		throw InvalidInputException("Number of rows to append must be positive");
+	}
+	auto &active_types = GetActiveTypes();
+	columns_chunk.Destroy();
+	columns_chunk.Initialize(allocator, active_types, count);
+	columns_chunk.SetCardinality(count);
+	columns_set.assign(active_types.size(), false);
+	columns_active = true;
+}
+
+Vector &JdbcAppender::GetColumn(idx_t col_idx) {
+	if (!columns_active) {
+		throw InvalidInputException("Columns append was not started");
+	}
+	if (col_idx >= columns_chunk.ColumnCount()) {
+		throw InvalidInputException("Column index %llu is out of range, table has %llu columns", col_idx,
+		                            columns_chunk.ColumnCount());
+	}
+	auto &vec = columns_chunk.data[col_idx];
+	// the column may be set again after a failed attempt
+	FlatVector::Validity(vec).Reset(columns_chunk.GetCapacity());
+	return vec;
+}
+
+void JdbcAppender::MarkColumnSet(idx_t col_idx) {
+	D_ASSERT(columns_active && col_idx < columns_set.size());
+	columns_set[col_idx] = true;
+}
+
+idx_t JdbcAppender::ColumnsCount() const {
+	return columns_active ? columns_chunk.size() : 0;
+}
+
+void JdbcAppender::EndColumns() {
+	if (!columns_active) {
+		throw InvalidInputException("Columns append was not started");
+	}
+	columns_active = false;
+	for (idx_t col_idx = 0; col_idx < columns_set.size(); col_idx++) {
+		if (!columns_set[col_idx]) {
+			throw InvalidInputException("Values of column %llu were not set", col_idx);
+		}
+	}
+	// rows appended row-wise before must be appended first
+	FlushChunk();
+	// flush column-wise blocks every multiple of the row group size, so bulk appended data fills whole row groups
+	// instead of being split in partially filled ones at the flush boundaries
+	auto flush_threshold = MaxValue<idx_t>(flush_count / DEFAULT_ROW_GROUP_SIZE, 1) * DEFAULT_ROW_GROUP_SIZE;
+	auto total_count = columns_chunk.size();
+	DataChunk slice;
+	slice.InitializeEmpty(columns_chunk.GetTypes());
+	idx_t offset = 0;
+	while (offset < total_count) {
+		auto pending_count = collection->Count();
+		if (pending_count >= flush_threshold) {
+			Flush();
+			continue;
+		}
+		auto slice_count = MinValue<idx_t>(total_count - offset, flush_threshold - pending_count);
+		if (slice_count == total_count) {
+			collection->Append(columns_chunk);
+		} else {
+			slice.Reference(columns_chunk);
+			slice.Slice(offset, slice_count);
+			collection->Append(slice);
+		}
+		offset += slice_count;
+		if (collection->Count() >= flush_threshold) {
+			Flush();
+		}
+	}
+	columns_chunk.Destroy();
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+/**
+ * Appender used by the JDBC driver. In addition to the row-wise appends of the base class it allows to append
+ * a block of rows column-wise: BeginColumns(count), then the values of every column are written directly into
+ * the vector returned by GetColumn and, after all the columns are set, EndColumns() appends the block.
+ */
+class JdbcAppender : public duckdb::Appender {
+public:
+	JdbcAppender(duckdb::Connection &con, const std::string &schema_name, const std::string &table_name);
+
+	//! Starts appending count rows column-wise, must not be called in the middle of a row
+	void BeginColumns(idx_t count);
+	//! Returns the vector for the values of the specified column, with all the rows valid
+	duckdb::Vector &GetColumn(idx_t col_idx);
+	//! Marks the values of the column as set, must be called after the vector of the column is filled
+	void MarkColumnSet(idx_t col_idx);
+	//! Number of rows in the block started with BeginColumns
+	idx_t ColumnsCount() const;
+	//! Appends the block of rows, the values of all the columns must be set
+	void EndColumns();
+
+private:
+	duckdb::DataChunk columns_chunk;
+	duckdb::vector<bool> columns_set;
+	bool columns_active = false;
+};
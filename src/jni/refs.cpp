@@ -34,6 +34,12 @@ jclass J_TimestampTZ;
 jclass J_BigDecimal;
 jclass J_HugeInt;
 jclass J_ByteArray;
+jclass J_BooleanArray;
+jclass J_ShortArray;
+jclass J_IntArray;
+jclass J_LongArray;
+jclass J_FloatArray;
+jclass J_DoubleArray;
 
 jmethodID J_Bool_booleanValue;
 jmethodID J_Byte_byteValue;
@@ -59,6 +65,8 @@ jclass J_DuckVector;
 jmethodID J_DuckVector_init;
 jfieldID J_DuckVector_constlen;
 jfieldID J_DuckVector_varlen;
+jfieldID J_DuckVector_string_data;
+jfieldID J_DuckVector_string_offsets;
 
 jclass J_DuckArray;
 jmethodID J_DuckArray_init;
@@ -195,6 +203,12 @@ void create_refs(JNIEnv *env) {
 	J_BigDecimal = make_class_ref(env, "java/math/BigDecimal");
 	J_HugeInt = make_class_ref(env, "org/duckdb/DuckDBHugeInt");
 	J_ByteArray = make_class_ref(env, "[B");
+	J_BooleanArray = make_class_ref(env, "[Z");
+	J_ShortArray = make_class_ref(env, "[S");
+	J_IntArray = make_class_ref(env, "[I");
+	J_LongArray = make_class_ref(env, "[J");
+	J_FloatArray = make_class_ref(env, "[F");
+	J_DoubleArray = make_class_ref(env, "[D");
 
 	J_Timestamp = make_class_ref(env, "org/duckdb/DuckDBTimestamp");
 	J_Timestamp_valueOf = get_static_method_id(env, J_Timestamp, "valueOf", "(Ljava/lang/Object;)Ljava/lang/Object;");
@@ -269,9 +283,11 @@ void create_refs(JNIEnv *env) {
 
 	J_String_getBytes = get_method_id(env, J_String, "getBytes", "(Ljava/nio/charset/Charset;)[B");
 
-	J_DuckVector_init = get_method_id(env, J_DuckVector, "<init>", "(Ljava/lang/String;I[Z)V");
+	J_DuckVector_init = get_method_id(env, J_DuckVector, "<init>", "(Ljava/lang/String;ILjava/nio/ByteBuffer;)V");
 	J_DuckVector_constlen = get_field_id(env, J_DuckVector, "constlen_data", "Ljava/nio/ByteBuffer;");
 	J_DuckVector_varlen = get_field_id(env, J_DuckVector, "varlen_data", "[Ljava/lang/Object;");
+	J_DuckVector_string_data = get_field_id(env, J_DuckVector, "string_data", "[B");
+	J_DuckVector_string_offsets = get_field_id(env, J_DuckVector, "string_offsets", "[I");
 
 	J_ByteBuffer = make_class_ref(env, "java/nio/ByteBuffer");
 	J_ByteBuffer_order = get_method_id(env, J_ByteBuffer, "order", "(Ljava/nio/ByteOrder;)Ljava/nio/ByteBuffer;");
@@ -31,6 +31,12 @@ extern jclass J_TimestampTZ;
 extern jclass J_BigDecimal;
 extern jclass J_HugeInt;
 extern jclass J_ByteArray;
+extern jclass J_BooleanArray;
+extern jclass J_ShortArray;
+extern jclass J_IntArray;
+extern jclass J_LongArray;
+extern jclass J_FloatArray;
+extern jclass J_DoubleArray;
 
 extern jmethodID J_Bool_booleanValue;
 extern jmethodID J_Byte_byteValue;
@@ -56,6 +62,8 @@ extern jclass J_DuckVector;
 extern jmethodID J_DuckVector_init;
 extern jfieldID J_DuckVector_constlen;
 extern jfieldID J_DuckVector_varlen;
+extern jfieldID J_DuckVector_string_data;
+extern jfieldID J_DuckVector_string_offsets;
 
 extern jclass J_DuckArray;
 extern jmethodID J_DuckArray_init;
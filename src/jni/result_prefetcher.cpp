@@ -0,0 +1,91 @@
+#include "result_prefetcher.hpp"
+
+using namespace duckdb;
+
+ResultPrefetcher::ResultPrefetcher(QueryResult &result_p, idx_t max_chunks_p, idx_t max_bytes_p)
+    : result(result_p), max_chunks(max_chunks_p), max_bytes(max_bytes_p) {
+	thread = std::thread([this]() { Run(); });
+}
+
+ResultPrefetcher::~ResultPrefetcher() {
+	Stop();
+}
+
+bool ResultPrefetcher::CanBuffer() const {
+	if (chunks.empty()) {
+		return true;
+	}
+	if (chunks.size() >= max_chunks) {
+		return false;
+	}
+	return max_bytes == 0 || buffered_bytes < max_bytes;
+}
+
+void ResultPrefetcher::Run() {
+	while (true) {
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			cv.wait(guard, [this]() { return stopped || CanBuffer(); });
+			if (stopped) {
+				return;
+			}
+		}
+
+		// the result is fetched without holding the lock, so the consumer can take ready chunks meanwhile
+		unique_ptr<DataChunk> chunk;
+		ErrorData fetch_error;
+		try {
+			chunk = result.Fetch();
+		} catch (const std::exception &e) {
+			fetch_error = ErrorData(e);
+		}
+
+		std::lock_guard<std::mutex> guard(lock);
+		if (fetch_error.HasError()) {
+			error = std::move(fetch_error);
+			finished = true;
+		} else if (!chunk || chunk->size() == 0) {
+			// a stream result does not throw when the query fails, it stores the error and returns no chunk
+			if (result.HasError()) {
+				error = result.GetErrorObject();
+			}
+			finished = true;
+		} else {
+			buffered_bytes += chunk->GetAllocationSize();
+			chunks.push_back(std::move(chunk));
+		}
+		cv.notify_all();
+		if (finished) {
+			return;
+		}
+	}
+}
+
+unique_ptr<DataChunk> ResultPrefetcher::Fetch() {
+	std::unique_lock<std::mutex> guard(lock);
+	cv.wait(guard, [this]() { return !chunks.empty() || finished || stopped; });
+	if (!chunks.empty()) {
+		auto chunk = std::move(chunks.front());
+		chunks.pop_front();
+		buffered_bytes -= chunk->GetAllocationSize();
+		cv.notify_all();
+		return chunk;
+	}
+	if (error.HasError()) {
+		error.Throw();
+	}
+	return nullptr;
+}
+
+void ResultPrefetcher::Stop() {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		stopped = true;
+		chunks.clear();
+		buffered_bytes = 0;
+		cv.notify_all();
+	}
+	if (thread.joinable()) {
+		thread.join();
+	}
+}
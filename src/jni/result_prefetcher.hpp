@@ -0,0 +1,48 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+/**
+ * Fetches chunks of a streaming query result on a background thread, so the engine keeps executing the query
+ * while the Java thread converts and consumes the chunks fetched before. At most max_chunks chunks, and at most
+ * max_bytes of chunk memory (at least one chunk is always allowed), are kept ready.
+ *
+ * While the prefetcher is running the wrapped result must only be accessed through it.
+ */
+class ResultPrefetcher {
+public:
+	ResultPrefetcher(duckdb::QueryResult &result, idx_t max_chunks, idx_t max_bytes);
+	~ResultPrefetcher();
+
+	ResultPrefetcher(const ResultPrefetcher &) = delete;
+	ResultPrefetcher &operator=(const ResultPrefetcher &) = delete;
+
+	//! Returns the next chunk, blocks until one is ready. Returns nullptr when the result is exhausted, rethrows
+	//! the error when fetching from the result failed.
+	duckdb::unique_ptr<duckdb::DataChunk> Fetch();
+	//! Stops the background thread and discards the chunks that were not fetched yet.
+	void Stop();
+
+private:
+	void Run();
+	bool CanBuffer() const;
+
+	duckdb::QueryResult &result;
+	const idx_t max_chunks;
+	const idx_t max_bytes;
+
+	std::mutex lock;
+	std::condition_variable cv;
+	std::deque<duckdb::unique_ptr<duckdb::DataChunk>> chunks;
+	idx_t buffered_bytes = 0;
+	bool finished = false;
+	bool stopped = false;
+	duckdb::ErrorData error;
+
+	std::thread thread;
+};
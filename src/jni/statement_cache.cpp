@@ -0,0 +1,150 @@
+#include "statement_cache.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+
+using namespace duckdb;
+
+/**
+ * Counts the executed prepared statements that can change how queries are bound, e.g. a SET of a setting that the
+ * binder reads. Plans cached before such a statement was executed are not reused.
+ */
+class StatementCacheState : public ClientContextState {
+public:
+	static constexpr const char *NAME = "jdbc_statement_cache";
+
+	RebindQueryInfo OnExecutePrepared(ClientContext &context, PreparedStatementCallbackInfo &info,
+	                                  RebindQueryInfo current_rebind) override {
+		if (StatementCache::ChangesBinding(info.prepared_statement.statement_type)) {
+			binding_version++;
+		}
+		return RebindQueryInfo::DO_NOT_REBIND;
+	}
+
+	std::atomic<idx_t> binding_version {0};
+};
+
+bool StatementCache::ChangesBinding(StatementType type) {
+	switch (type) {
+	case StatementType::SET_STATEMENT:
+	case StatementType::VARIABLE_SET_STATEMENT:
+	case StatementType::PRAGMA_STATEMENT:
+	case StatementType::LOAD_STATEMENT:
+	case StatementType::ATTACH_STATEMENT:
+	case StatementType::DETACH_STATEMENT:
+	case StatementType::EXTENSION_STATEMENT:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void StatementCache::InvalidateAll(ClientContext &context) {
+	context.registered_state->GetOrCreate<StatementCacheState>(StatementCacheState::NAME)->binding_version++;
+}
+
+idx_t StatementCache::GetBindingVersion(ClientContext &context) {
+	return context.registered_state->GetOrCreate<StatementCacheState>(StatementCacheState::NAME)->binding_version;
+}
+
+std::string StatementCache::MakeKey(ClientContext &context, const std::string &query) {
+	// unqualified names in the query are bound against the entries of the search path
+	auto &search_path = ClientData::Get(context).catalog_search_path;
+	return CatalogSearchEntry::ListToString(search_path->Get()) + "\n" + query;
+}
+
+StatementCache::CatalogVersions StatementCache::GetCatalogVersions(ClientContext &context) {
+	CatalogVersions versions;
+	context.RunFunctionInTransaction([&]() {
+		for (auto &db : DatabaseManager::Get(context).GetDatabases(context)) {
+			auto version = db.get().GetCatalog().GetCatalogVersion(context);
+			auto version_idx = version.IsValid() ? version.GetIndex() : DConstants::INVALID_INDEX;
+			versions.emplace_back(db.get().GetName(), version_idx);
+		}
+	});
+	return versions;
+}
+
+bool StatementCache::IsValid(ClientContext &context, const Entry &entry) {
+	if (entry.binding_version != GetBindingVersion(context)) {
+		return false;
+	}
+	auto &data = *entry.data;
+	// the catalog versions are checked the same way as before executing a prepared statement,
+	// with values of the types the parameters were bound with
+	case_insensitive_map_t<BoundParameterData> values;
+	for (auto &it : data.value_map) {
+		values.emplace(it.first, BoundParameterData(Value(it.second->return_type)));
+	}
+	bool require_rebind = true;
+	try {
+		context.RunFunctionInTransaction([&]() { require_rebind = data.RequireRebind(context, values); });
+		// a change to any catalog can change how the query is bound, e.g. a temporary table that shadows a table
+		if (!require_rebind && GetCatalogVersions(context) != entry.catalog_versions) {
+			require_rebind = true;
+		}
+	} catch (std::exception &) {
+		// e.g. a database the statement depends on was detached
+		return false;
+	}
+	return !require_rebind;
+}
+
+unique_ptr<PreparedStatement> StatementCache::Get(ClientContext &context, const std::string &query) {
+	auto key = MakeKey(context, query);
+	Entry entry;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		auto it = index.find(key);
+		if (it == index.end()) {
+			return nullptr;
+		}
+		entries.splice(entries.begin(), entries, it->second);
+		entry = *it->second;
+	}
+
+	if (!IsValid(context, entry)) {
+		std::lock_guard<std::mutex> guard(lock);
+		auto it = index.find(key);
+		if (it != index.end() && it->second->data == entry.data) {
+			entries.erase(it->second);
+			index.erase(it);
+		}
+		return nullptr;
+	}
+	return make_uniq<PreparedStatement>(context.shared_from_this(), std::move(entry.data), query,
+	                                    std::move(entry.named_param_map));
+}
+
+void StatementCache::Put(ClientContext &context, const std::string &query, PreparedStatement &stmt,
+                         idx_t capacity) {
+	auto &data = stmt.data;
+	if (capacity == 0 || !data || data->properties.always_require_rebind || !data->properties.bound_all_parameters) {
+		return;
+	}
+	auto key = MakeKey(context, query);
+	auto binding_version = GetBindingVersion(context);
+	CatalogVersions catalog_versions;
+	try {
+		catalog_versions = GetCatalogVersions(context);
+	} catch (std::exception &) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+	auto it = index.find(key);
+	if (it != index.end()) {
+		entries.erase(it->second);
+		index.erase(it);
+	}
+	entries.push_front(Entry {key, data, stmt.named_param_map, std::move(catalog_versions), binding_version});
+	index[key] = entries.begin();
+	while (entries.size() > capacity) {
+		index.erase(entries.back().key);
+		entries.pop_back();
+	}
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/main/client_context_state.hpp"
+
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * LRU cache of prepared statement plans of a connection, keyed by the SQL text and the catalog search path it was
+ * prepared with. Repeated prepares of the same SQL skip parsing, binding and planning.
+ *
+ * Cached plans are only reused while the versions of all the attached catalogs (including the temporary objects, so
+ * a new temporary table can shadow a table of the plan) are unchanged, and no statement that can change how queries
+ * are bound (SET, PRAGMA, ATTACH, ...) was executed since the plan was prepared.
+ * The statements created from a cached plan share it, this is safe as a connection executes one query at a time.
+ */
+class StatementCache {
+public:
+	//! Whether executing a statement of this type can change how other queries are bound
+	static bool ChangesBinding(duckdb::StatementType type);
+	//! Invalidates the cached plans of the connection, used for statements that are not executed as prepared
+	//! statements
+	static void InvalidateAll(duckdb::ClientContext &context);
+
+	//! Returns a statement for the cached plan of the query, or nullptr if there is no valid cached plan
+	duckdb::unique_ptr<duckdb::PreparedStatement> Get(duckdb::ClientContext &context, const std::string &query);
+	//! Adds the plan of a successfully prepared statement, evicting the least recently used plans above capacity
+	void Put(duckdb::ClientContext &context, const std::string &query, duckdb::PreparedStatement &stmt,
+	         idx_t capacity);
+
+private:
+	//! Versions of the attached catalogs by name
+	using CatalogVersions = std::vector<std::pair<std::string, idx_t>>;
+
+	struct Entry {
+		std::string key;
+		duckdb::shared_ptr<duckdb::PreparedStatementData> data;
+		duckdb::case_insensitive_map_t<idx_t> named_param_map;
+		CatalogVersions catalog_versions;
+		idx_t binding_version;
+	};
+
+	static std::string MakeKey(duckdb::ClientContext &context, const std::string &query);
+	static CatalogVersions GetCatalogVersions(duckdb::ClientContext &context);
+	static idx_t GetBindingVersion(duckdb::ClientContext &context);
+	static bool IsValid(duckdb::ClientContext &context, const Entry &entry);
+
+	std::mutex lock;
+	//! Most recently used entries first
+	std::list<Entry> entries;
+	std::unordered_map<std::string, std::list<Entry>::iterator> index;
+};
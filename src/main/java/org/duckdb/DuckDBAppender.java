@@ -66,6 +66,8 @@ public class DuckDBAppender implements AutoCloseable {
 
     private static final int STRING_MAX_INLINE_BYTES = 12;
 
+    private static final int PENDING_STRINGS_INITIAL_BYTES = 1 << 16;
+
     private static final LocalDateTime EPOCH_DATE_TIME = LocalDateTime.ofEpochSecond(0, 0, UTC);
 
     private final DuckDBConnection conn;
@@ -195,6 +197,10 @@ public class DuckDBAppender implements AutoCloseable {
         try {
             checkOpen();
 
+            for (Column col : columns) {
+                col.assignPendingStrings();
+            }
+
             duckdb_data_chunk_set_size(chunkRef, rowIdx);
 
             int appendState = duckdb_append_data_chunk(appenderRef, chunkRef);
@@ -1098,10 +1104,12 @@ public class DuckDBAppender implements AutoCloseable {
     }
 
     public DuckDBAppender appendDefault() throws SQLException {
-        currentColumn();
+        Column col = currentColumn();
         appenderRefLock.lock();
         try {
             checkOpen();
+            // pending strings must not overwrite the default value
+            col.assignPendingStrings();
             duckdb_append_default_to_chunk(appenderRef, chunkRef, colIdx, rowIdx);
         } finally {
             appenderRefLock.unlock();
@@ -1337,22 +1345,18 @@ public class DuckDBAppender implements AutoCloseable {
     }
 
     private DuckDBAppender appendStringOrBlobInternal(CAPIType ctype, byte[] bytes) throws SQLException {
-        if (writeInlinedStrings && bytes.length < STRING_MAX_INLINE_BYTES) {
-            Column col = currentColumnWithRowPos(ctype);
+        Column col = currentColumn();
+        checkColumnType(col, ctype);
+        // Short strings are written inline directly, unless they are in the middle of a pending
+        // range, all other strings are collected and assigned to the vector in a single call
+        if (writeInlinedStrings && bytes.length < STRING_MAX_INLINE_BYTES && 0 == col.pendingStringsCount) {
+            col = currentColumnWithRowPos(ctype);
             col.data.putInt(bytes.length);
             if (bytes.length > 0) {
                 col.data.put(bytes);
             }
         } else {
-            Column col = currentColumn();
-            checkColumnType(col, ctype);
-            appenderRefLock.lock();
-            try {
-                checkOpen();
-                duckdb_vector_assign_string_element_len(col.vectorRef, rowIdx, bytes);
-            } finally {
-                appenderRefLock.unlock();
-            }
+            col.addPendingString(rowIdx, bytes, maxRows);
         }
 
         incrementColOrStructFieldIdx();
@@ -1498,6 +1502,13 @@ public class DuckDBAppender implements AutoCloseable {
         private ByteBuffer validity;
         private final List<Column> children = new ArrayList<>();
 
+        // strings that are not yet assigned to the vector, for rows
+        // [pendingStringsStartRow, pendingStringsStartRow + pendingStringsCount)
+        private ByteBuffer pendingStringsData;
+        private ByteBuffer pendingStringsOffsets;
+        private long pendingStringsStartRow = 0;
+        private int pendingStringsCount = 0;
+
         private Column(Column parent, ByteBuffer colTypeRef, ByteBuffer vector) throws SQLException {
             this.parent = parent;
             this.colTypeRef = colTypeRef;
@@ -1601,6 +1612,51 @@ public class DuckDBAppender implements AutoCloseable {
             entries.put(mask);
         }
 
+        void addPendingString(long rowIdx, byte[] bytes, long maxRows) {
+            if (null == pendingStringsOffsets) {
+                pendingStringsOffsets = ByteBuffer.allocateDirect((int) (maxRows + 1) * Integer.BYTES);
+                pendingStringsOffsets.order(ByteOrder.nativeOrder());
+                pendingStringsData = ByteBuffer.allocateDirect(PENDING_STRINGS_INITIAL_BYTES);
+            }
+            if (0 == pendingStringsCount) {
+                pendingStringsStartRow = rowIdx;
+                pendingStringsOffsets.putInt(0, 0);
+            }
+
+            // rows skipped in between (NULLs) are filled with empty strings
+            while (pendingStringsStartRow + pendingStringsCount < rowIdx) {
+                pendingStringsCount++;
+                pendingStringsOffsets.putInt(pendingStringsCount * Integer.BYTES, pendingStringsData.position());
+            }
+
+            if (pendingStringsData.remaining() < bytes.length) {
+                int capacity =
+                    Math.max(pendingStringsData.capacity() * 2, pendingStringsData.position() + bytes.length);
+                ByteBuffer grown = ByteBuffer.allocateDirect(capacity);
+                pendingStringsData.flip();
+                grown.put(pendingStringsData);
+                pendingStringsData = grown;
+            }
+            pendingStringsData.put(bytes);
+            pendingStringsCount++;
+            pendingStringsOffsets.putInt(pendingStringsCount * Integer.BYTES, pendingStringsData.position());
+        }
+
+        void assignPendingStrings() throws SQLException {
+            if (pendingStringsCount > 0) {
+                try {
+                    duckdb_vector_assign_string_elements(vectorRef, pendingStringsStartRow, pendingStringsCount,
+                                                         pendingStringsData, pendingStringsOffsets);
+                } finally {
+                    pendingStringsData.clear();
+                    pendingStringsCount = 0;
+                }
+            }
+            for (Column col : children) {
+                col.assignPendingStrings();
+            }
+        }
+
         long widthBytes() {
             if (colType == DUCKDB_TYPE_DECIMAL) {
                 return decimalInternalType.widthBytes;
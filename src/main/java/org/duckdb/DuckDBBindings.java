@@ -57,6 +57,10 @@ public class DuckDBBindings {
 
     static native void duckdb_vector_assign_string_element_len(ByteBuffer vector, long index, byte[] str);
 
+    // offsets: count + 1 native-order int offsets into data
+    static native void duckdb_vector_assign_string_elements(ByteBuffer vector, long start_index, long count,
+                                                            ByteBuffer data, ByteBuffer offsets);
+
     static native ByteBuffer duckdb_list_vector_get_child(ByteBuffer vector);
 
     static native long duckdb_list_vector_get_size(ByteBuffer vector);
@@ -23,6 +23,9 @@ public class DuckDBDriver implements java.sql.Driver {
     public static final String DUCKDB_READONLY_PROPERTY = "duckdb.read_only";
     public static final String DUCKDB_USER_AGENT_PROPERTY = "custom_user_agent";
     public static final String JDBC_STREAM_RESULTS = "jdbc_stream_results";
+    public static final String JDBC_PREFETCH_CHUNKS = "jdbc_prefetch_chunks";
+    public static final String JDBC_PREFETCH_BUFFER_SIZE = "jdbc_prefetch_buffer_size";
+    public static final String JDBC_STATEMENT_CACHE_SIZE = "jdbc_statement_cache_size";
     public static final String JDBC_AUTO_COMMIT = "jdbc_auto_commit";
     public static final String JDBC_PIN_DB = "jdbc_pin_db";
     public static final String JDBC_IGNORE_UNSUPPORTED_OPTIONS = "jdbc_ignore_unsupported_options";
@@ -143,6 +146,12 @@ public class DuckDBDriver implements java.sql.Driver {
         list.add(createDriverPropInfo(DUCKDB_READONLY_PROPERTY, "", "Set connection to read-only mode"));
         list.add(createDriverPropInfo(DUCKDB_USER_AGENT_PROPERTY, "", "Custom user agent string"));
         list.add(createDriverPropInfo(JDBC_STREAM_RESULTS, "", "Enable result set streaming"));
+        list.add(createDriverPropInfo(JDBC_PREFETCH_CHUNKS, "",
+                                      "Number of streamed result chunks to fetch in background, 0 disables"));
+        list.add(createDriverPropInfo(JDBC_PREFETCH_BUFFER_SIZE, "",
+                                      "Memory limit in bytes for prefetched result chunks, 0 means no limit"));
+        list.add(createDriverPropInfo(JDBC_STATEMENT_CACHE_SIZE, "",
+                                      "Number of prepared statement plans cached per connection, 0 disables"));
         list.add(createDriverPropInfo(JDBC_AUTO_COMMIT, "", "Set default auto-commit mode"));
         list.add(createDriverPropInfo(JDBC_PIN_DB, "",
                                       "Do not close the DB instance after all connections to it are closed"));
@@ -103,16 +103,30 @@ final class DuckDBNative {
     static native DuckDBResultSetMetaData duckdb_jdbc_prepared_statement_meta(ByteBuffer stmt_ref) throws SQLException;
 
     // returns res_ref result reference object
-    static native ByteBuffer duckdb_jdbc_execute(ByteBuffer stmt_ref, Object[] params) throws SQLException;
+    // param_types and param_values hold the type tags and the unboxed values of primitive parameters,
+    // see DuckDBParameters
+    static native ByteBuffer duckdb_jdbc_execute(ByteBuffer stmt_ref, Object[] params, byte[] param_types,
+                                                 long[] param_values) throws SQLException;
+
+    // executes the statement for every entry of the batch, parameters are passed column-wise,
+    // value of parameter p for entry r is at index p * row_count + r; returns update counts
+    static native long[] duckdb_jdbc_execute_batch(ByteBuffer stmt_ref, Object[] params, byte[] param_types,
+                                                   long[] param_values, int row_count) throws SQLException;
 
     static native void duckdb_jdbc_free_result(ByteBuffer res_ref);
 
-    static native DuckDBVector[] duckdb_jdbc_fetch(ByteBuffer res_ref, ByteBuffer conn_ref) throws SQLException;
+    // fetch_size is the minimum number of rows to return, values not above the vector size fetch a single chunk
+    static native DuckDBVector[] duckdb_jdbc_fetch(ByteBuffer res_ref, ByteBuffer conn_ref, int fetch_size)
+        throws SQLException;
 
     static native int duckdb_jdbc_fetch_size();
 
     static native long duckdb_jdbc_arrow_stream(ByteBuffer res_ref, long batch_size);
 
+    // executes the statement collecting its result directly into Arrow arrays, returns ArrowArrayStream pointer
+    static native long duckdb_jdbc_execute_arrow(ByteBuffer stmt_ref, Object[] params, byte[] param_types,
+                                                 long[] param_values, long batch_size) throws SQLException;
+
     static native void duckdb_jdbc_arrow_register(ByteBuffer conn_ref, long arrow_array_stream_pointer, byte[] name);
 
     static native ByteBuffer duckdb_jdbc_create_appender(ByteBuffer conn_ref, byte[] schema_name, byte[] table_name)
@@ -155,6 +169,18 @@ final class DuckDBNative {
 
     static native void duckdb_jdbc_appender_append_null(ByteBuffer appender_ref) throws SQLException;
 
+    static native void duckdb_jdbc_appender_begin_columns(ByteBuffer appender_ref, int row_count) throws SQLException;
+
+    // values is a primitive array or a direct ByteBuffer, bit (offset + i) of null_mask marks row i as NULL
+    static native void duckdb_jdbc_appender_append_column(ByteBuffer appender_ref, int col_idx, Object values,
+                                                          int offset, long[] null_mask) throws SQLException;
+
+    static native void duckdb_jdbc_appender_append_string_column(ByteBuffer appender_ref, int col_idx, byte[] data,
+                                                                 int[] offsets, int offset, long[] null_mask)
+        throws SQLException;
+
+    static native void duckdb_jdbc_appender_end_columns(ByteBuffer appender_ref) throws SQLException;
+
     static native void duckdb_jdbc_create_extension_type(ByteBuffer conn_ref) throws SQLException;
 
     protected static native String duckdb_jdbc_get_profiling_information(ByteBuffer conn_ref,
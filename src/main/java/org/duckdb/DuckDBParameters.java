@@ -0,0 +1,75 @@
+package org.duckdb;
+
+/**
+ * Values bound to the parameters of a prepared statement.
+ *
+ * Primitive values are stored unboxed in {@code values} with their type tag in {@code types},
+ * so native code can create DuckDB values from them without calling back into Java.
+ * All other values, including {@code null}, are stored in {@code objects} with type tag {@code OBJECT}.
+ */
+final class DuckDBParameters {
+    // Type tags, must be kept in sync with ParamType enum in duckdb_java.cpp
+    static final byte OBJECT = 0;
+    static final byte BOOLEAN = 1;
+    static final byte TINYINT = 2;
+    static final byte SMALLINT = 3;
+    static final byte INTEGER = 4;
+    static final byte BIGINT = 5;
+    static final byte FLOAT = 6;
+    static final byte DOUBLE = 7;
+
+    static final DuckDBParameters EMPTY = new DuckDBParameters(0);
+
+    final Object[] objects;
+    final byte[] types;
+    final long[] values;
+
+    DuckDBParameters(int count) {
+        this.objects = new Object[count];
+        this.types = new byte[count];
+        this.values = new long[count];
+    }
+
+    int size() {
+        return objects.length;
+    }
+
+    void setObject(int idx, Object x) {
+        if (x instanceof Integer) {
+            setPrimitive(idx, INTEGER, (Integer) x);
+        } else if (x instanceof Long) {
+            setPrimitive(idx, BIGINT, (Long) x);
+        } else if (x instanceof Double) {
+            setDouble(idx, (Double) x);
+        } else if (x instanceof Boolean) {
+            setBoolean(idx, (Boolean) x);
+        } else if (x instanceof Short) {
+            setPrimitive(idx, SMALLINT, (Short) x);
+        } else if (x instanceof Byte) {
+            setPrimitive(idx, TINYINT, (Byte) x);
+        } else if (x instanceof Float) {
+            setFloat(idx, (Float) x);
+        } else {
+            objects[idx] = x;
+            types[idx] = OBJECT;
+        }
+    }
+
+    void setBoolean(int idx, boolean x) {
+        setPrimitive(idx, BOOLEAN, x ? 1 : 0);
+    }
+
+    void setFloat(int idx, float x) {
+        setPrimitive(idx, FLOAT, Float.floatToRawIntBits(x));
+    }
+
+    void setDouble(int idx, double x) {
+        setPrimitive(idx, DOUBLE, Double.doubleToRawLongBits(x));
+    }
+
+    void setPrimitive(int idx, byte type, long x) {
+        objects[idx] = null;
+        types[idx] = type;
+        values[idx] = x;
+    }
+}
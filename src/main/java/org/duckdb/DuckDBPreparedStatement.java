@@ -55,13 +55,14 @@ public class DuckDBPreparedStatement implements PreparedStatement {
     private boolean returnsChangedRows = false;
     private boolean returnsNothing = false;
     private boolean returnsResultSet = false;
-    private Object[] params = new Object[0];
+    private DuckDBParameters params = DuckDBParameters.EMPTY;
     private DuckDBResultSetMetaData meta = null;
-    private final List<Object[]> batchedParams = new ArrayList<>();
+    private final List<DuckDBParameters> batchedParams = new ArrayList<>();
     private final List<String> batchedStatements = new ArrayList<>();
     private Boolean isBatch = false;
     private Boolean isPreparedStatement = false;
     private int queryTimeoutSeconds = 0;
+    int fetchSize = 0;
     private ScheduledFuture<?> cancelQueryFuture = null;
 
     public DuckDBPreparedStatement(DuckDBConnection conn) throws SQLException {
@@ -126,7 +127,7 @@ public class DuckDBPreparedStatement implements PreparedStatement {
             }
 
             meta = null;
-            params = new Object[0];
+            params = DuckDBParameters.EMPTY;
 
             if (selectResult != null) {
                 selectResult.close();
@@ -190,7 +191,7 @@ public class DuckDBPreparedStatement implements PreparedStatement {
                     DuckDBDriver.scheduler.schedule(new CancelQueryTask(), queryTimeoutSeconds, SECONDS);
             }
 
-            resultRef = DuckDBNative.duckdb_jdbc_execute(stmtRef, params);
+            resultRef = DuckDBNative.duckdb_jdbc_execute(stmtRef, params.objects, params.types, params.values);
             cleanupCancelQueryTask();
             DuckDBResultSetMetaData resultMeta = DuckDBNative.duckdb_jdbc_query_result_meta(resultRef);
             selectResult = new DuckDBResultSet(conn, this, resultMeta, resultRef);
@@ -223,6 +224,70 @@ public class DuckDBPreparedStatement implements PreparedStatement {
         return returnsResultSet;
     }
 
+    /**
+     * Execute the statement and export its result as an ArrowReader
+     *
+     * Unlike {@link DuckDBResultSet#arrowExportStream}, the Arrow vectors are produced by the query
+     * pipeline itself, in parallel when the query does not need to preserve the insertion order,
+     * and the whole result is materialized when this method returns.
+     *
+     * @param arrow_buffer_allocator an instance of {@link org.apache.arrow.memory.BufferAllocator}
+     * @param arrow_batch_size batch size of arrow vectors to return
+     * @return an instance of {@link org.apache.arrow.vector.ipc.ArrowReader}
+     */
+    public Object arrowExportStream(Object arrow_buffer_allocator, long arrow_batch_size) throws SQLException {
+        requireNonBatch();
+        checkOpen();
+        checkPrepared();
+        DuckDBResultSet.checkArrowBufferAllocator(arrow_buffer_allocator);
+
+        long streamPointer = arrowExportStreamPointer(arrow_batch_size);
+        return DuckDBResultSet.importArrowStream(arrow_buffer_allocator, streamPointer);
+    }
+
+    // executes the statement into Arrow arrays, returns the ArrowArrayStream pointer that the caller must release
+    long arrowExportStreamPointer(long arrow_batch_size) throws SQLException {
+        requireNonBatch();
+        checkOpen();
+        checkPrepared();
+
+        // Wait with dispatching a new query if connection is locked by cancel() call
+        Lock connLock = getConnRefLock();
+        connLock.lock();
+        connLock.unlock();
+
+        long streamPointer;
+        stmtRefLock.lock();
+        try {
+            checkOpen();
+            checkPrepared();
+
+            if (selectResult != null) {
+                selectResult.close();
+            }
+            selectResult = null;
+
+            if (!isConnAutoCommit()) {
+                startTransaction();
+            }
+
+            if (queryTimeoutSeconds > 0) {
+                cleanupCancelQueryTask();
+                cancelQueryFuture =
+                    DuckDBDriver.scheduler.schedule(new CancelQueryTask(), queryTimeoutSeconds, SECONDS);
+            }
+            try {
+                streamPointer = DuckDBNative.duckdb_jdbc_execute_arrow(stmtRef, params.objects, params.types,
+                                                                       params.values, arrow_batch_size);
+            } finally {
+                cleanupCancelQueryTask();
+            }
+        } finally {
+            stmtRefLock.unlock();
+        }
+        return streamPointer;
+    }
+
     @Override
     public ResultSet executeQuery() throws SQLException {
         requireNonBatch();
@@ -291,19 +356,12 @@ public class DuckDBPreparedStatement implements PreparedStatement {
 
     @Override
     public void setObject(int parameterIndex, Object x) throws SQLException {
-        checkOpen();
-        int paramsCount = getParameterMetaData().getParameterCount();
-        if (parameterIndex < 1 || parameterIndex > paramsCount) {
-            throw new SQLException("Parameter index out of bounds");
-        }
-        if (params.length == 0) {
-            params = new Object[paramsCount];
-        }
+        int idx = checkParameterIndex(parameterIndex);
         // we are doing lower/upper extraction from BigInteger on Java side
         if (x instanceof BigInteger) {
             x = new DuckDBHugeInt((BigInteger) x);
         }
-        params[parameterIndex - 1] = x;
+        params.setObject(idx, x);
     }
 
     @Override
@@ -313,37 +371,37 @@ public class DuckDBPreparedStatement implements PreparedStatement {
 
     @Override
     public void setBoolean(int parameterIndex, boolean x) throws SQLException {
-        setObject(parameterIndex, x);
+        params.setBoolean(checkParameterIndex(parameterIndex), x);
     }
 
     @Override
     public void setByte(int parameterIndex, byte x) throws SQLException {
-        setObject(parameterIndex, x);
+        params.setPrimitive(checkParameterIndex(parameterIndex), DuckDBParameters.TINYINT, x);
     }
 
     @Override
     public void setShort(int parameterIndex, short x) throws SQLException {
-        setObject(parameterIndex, x);
+        params.setPrimitive(checkParameterIndex(parameterIndex), DuckDBParameters.SMALLINT, x);
     }
 
     @Override
     public void setInt(int parameterIndex, int x) throws SQLException {
-        setObject(parameterIndex, x);
+        params.setPrimitive(checkParameterIndex(parameterIndex), DuckDBParameters.INTEGER, x);
     }
 
     @Override
     public void setLong(int parameterIndex, long x) throws SQLException {
-        setObject(parameterIndex, x);
+        params.setPrimitive(checkParameterIndex(parameterIndex), DuckDBParameters.BIGINT, x);
     }
 
     @Override
     public void setFloat(int parameterIndex, float x) throws SQLException {
-        setObject(parameterIndex, x);
+        params.setFloat(checkParameterIndex(parameterIndex), x);
     }
 
     @Override
     public void setDouble(int parameterIndex, double x) throws SQLException {
-        setObject(parameterIndex, x);
+        params.setDouble(checkParameterIndex(parameterIndex), x);
     }
 
     @Override
@@ -354,7 +412,7 @@ public class DuckDBPreparedStatement implements PreparedStatement {
     @Override
     public void clearParameters() throws SQLException {
         checkOpen();
-        params = new Object[0];
+        params = DuckDBParameters.EMPTY;
     }
 
     @Override
@@ -592,12 +650,16 @@ public class DuckDBPreparedStatement implements PreparedStatement {
     @Override
     public void setFetchSize(int rows) throws SQLException {
         checkOpen();
+        if (rows < 0) {
+            throw new SQLException("Fetch size has to be >= 0");
+        }
+        fetchSize = rows;
     }
 
     @Override
     public int getFetchSize() throws SQLException {
         checkOpen();
-        return DuckDBNative.duckdb_jdbc_fetch_size();
+        return fetchSize > 0 ? fetchSize : DuckDBNative.duckdb_jdbc_fetch_size();
     }
 
     @Override
@@ -652,14 +714,14 @@ public class DuckDBPreparedStatement implements PreparedStatement {
             checkOpen();
             checkPrepared();
 
+            if (selectResult != null) {
+                selectResult.close();
+            }
+            selectResult = null;
+
             tranStarted = startTransaction();
 
-            long[] updateCounts = new long[this.batchedParams.size()];
-            for (int i = 0; i < this.batchedParams.size(); i++) {
-                params = this.batchedParams.get(i);
-                execute(false);
-                updateCounts[i] = getUpdateCountInternal();
-            }
+            long[] updateCounts = executeParamsBatch();
             clearBatch();
 
             if (tranStarted && isConnAutoCommit()) {
@@ -678,6 +740,45 @@ public class DuckDBPreparedStatement implements PreparedStatement {
         }
     }
 
+    /**
+     * Executes the statement for all batched parameters with a single native call, the parameters
+     * are passed column-wise.
+     */
+    private long[] executeParamsBatch() throws SQLException {
+        int paramsCount = getParameterMetaData().getParameterCount();
+        int rowsCount = batchedParams.size();
+        Object[] objects = new Object[paramsCount * rowsCount];
+        byte[] types = new byte[objects.length];
+        long[] values = new long[objects.length];
+        for (int row = 0; row < rowsCount; row++) {
+            DuckDBParameters rowParams = batchedParams.get(row);
+            if (rowParams.size() != paramsCount) {
+                throw new SQLException("Parameter count mismatch");
+            }
+            for (int col = 0; col < paramsCount; col++) {
+                int idx = col * rowsCount + row;
+                objects[idx] = rowParams.objects[col];
+                types[idx] = rowParams.types[col];
+                values[idx] = rowParams.values[col];
+            }
+        }
+
+        // Wait with dispatching a new query if connection is locked by cancel() call
+        Lock connLock = getConnRefLock();
+        connLock.lock();
+        connLock.unlock();
+
+        if (queryTimeoutSeconds > 0) {
+            cleanupCancelQueryTask();
+            cancelQueryFuture = DuckDBDriver.scheduler.schedule(new CancelQueryTask(), queryTimeoutSeconds, SECONDS);
+        }
+        try {
+            return DuckDBNative.duckdb_jdbc_execute_batch(stmtRef, objects, types, values, rowsCount);
+        } finally {
+            cleanupCancelQueryTask();
+        }
+    }
+
     private long[] executeBatchedStatements() throws SQLException {
         stmtRefLock.lock();
         boolean tranStarted = false;
@@ -1233,6 +1334,22 @@ public class DuckDBPreparedStatement implements PreparedStatement {
         }
     }
 
+    /**
+     * Checks that the parameter index is valid and allocates the parameters storage
+     * on first use, returns 0-based index of the parameter.
+     */
+    private int checkParameterIndex(int parameterIndex) throws SQLException {
+        checkOpen();
+        int paramsCount = getParameterMetaData().getParameterCount();
+        if (parameterIndex < 1 || parameterIndex > paramsCount) {
+            throw new SQLException("Parameter index out of bounds");
+        }
+        if (params.size() == 0) {
+            params = new DuckDBParameters(paramsCount);
+        }
+        return parameterIndex - 1;
+    }
+
     private void checkPrepared() throws SQLException {
         if (stmtRef == null) {
             throw new SQLException("Prepare something first");
@@ -50,6 +50,7 @@ public class DuckDBResultSet implements ResultSet {
     private int chunkIdx = 0;
     private boolean finished = false;
     private boolean wasNull;
+    private int fetchSize;
 
     public DuckDBResultSet(DuckDBConnection conn, DuckDBPreparedStatement stmt, DuckDBResultSetMetaData meta,
                            ByteBuffer resultRef) throws SQLException {
@@ -61,6 +62,7 @@ public class DuckDBResultSet implements ResultSet {
         } catch (NullPointerException e) {
             throw new SQLException(e);
         }
+        this.fetchSize = stmt.fetchSize;
     }
 
     public Statement getStatement() throws SQLException {
@@ -140,13 +142,26 @@ public class DuckDBResultSet implements ResultSet {
     public synchronized Object arrowExportStream(Object arrow_buffer_allocator, long arrow_batch_size)
         throws SQLException {
         checkOpen();
+        checkArrowBufferAllocator(arrow_buffer_allocator);
 
+        long stream_pointer = DuckDBNative.duckdb_jdbc_arrow_stream(resultRef, arrow_batch_size);
+        return importArrowStream(arrow_buffer_allocator, stream_pointer);
+    }
+
+    static void checkArrowBufferAllocator(Object arrow_buffer_allocator) {
         try {
             Class<?> buffer_allocator_class = Class.forName("org.apache.arrow.memory.BufferAllocator");
             if (!buffer_allocator_class.isInstance(arrow_buffer_allocator)) {
                 throw new RuntimeException("Need to pass an Arrow BufferAllocator");
             }
-            Long stream_pointer = DuckDBNative.duckdb_jdbc_arrow_stream(resultRef, arrow_batch_size);
+        } catch (ClassNotFoundException e) {
+            throw new RuntimeException(e);
+        }
+    }
+
+    static Object importArrowStream(Object arrow_buffer_allocator, long stream_pointer) {
+        try {
+            Class<?> buffer_allocator_class = Class.forName("org.apache.arrow.memory.BufferAllocator");
             Class<?> arrow_array_stream_class = Class.forName("org.apache.arrow.c.ArrowArrayStream");
             Object arrow_array_stream =
                 arrow_array_stream_class.getMethod("wrap", long.class).invoke(null, stream_pointer);
@@ -670,11 +685,12 @@ public class DuckDBResultSet implements ResultSet {
         if (rows < 0) {
             throw new SQLException("Fetch size has to be >= 0");
         }
+        fetchSize = rows;
     }
 
     public int getFetchSize() throws SQLException {
         checkOpen();
-        return DuckDBNative.duckdb_jdbc_fetch_size();
+        return fetchSize > 0 ? fetchSize : DuckDBNative.duckdb_jdbc_fetch_size();
     }
 
     public int getType() throws SQLException {
@@ -1423,7 +1439,7 @@ public class DuckDBResultSet implements ResultSet {
             resultRefLock.lock();
             try {
                 checkOpen();
-                return DuckDBNative.duckdb_jdbc_fetch(resultRef, conn.connRef);
+                return DuckDBNative.duckdb_jdbc_fetch(resultRef, conn.connRef, fetchSize);
             } finally {
                 resultRefLock.unlock();
             }
@@ -93,6 +93,54 @@ public class DuckDBSingleValueAppender implements AutoCloseable {
         }
     }
 
+    /**
+     * Starts appending a block of {@code rowCount} rows column-wise. Values of every column must then be set
+     * with {@link #appendColumn} or {@link #appendStringColumn} before calling {@link #endColumns}.
+     * Must not be called in the middle of a row.
+     */
+    public void beginColumns(int rowCount) throws SQLException {
+        DuckDBNative.duckdb_jdbc_appender_begin_columns(appender_ref, rowCount);
+    }
+
+    /**
+     * Sets the values of a column for the started block of rows.
+     *
+     * @param columnIndex 0-based index of the column
+     * @param values array of primitives matching the physical type of the column ({@code boolean[]},
+     *               {@code byte[]}, {@code short[]}, {@code int[]}, {@code long[]}, {@code float[]} or
+     *               {@code double[]}), or a direct {@code ByteBuffer} with values in native byte order.
+     *               Values are taken as is, e.g. unscaled values for DECIMAL or microseconds since epoch
+     *               for TIMESTAMP columns
+     * @param offset index of the value for the first row of the block
+     * @param nullMask optional, row {@code i} is NULL if the bit {@code offset + i} of the mask is set
+     */
+    public void appendColumn(int columnIndex, Object values, int offset, long[] nullMask) throws SQLException {
+        DuckDBNative.duckdb_jdbc_appender_append_column(appender_ref, columnIndex, values, offset, nullMask);
+    }
+
+    /**
+     * Sets the values of a VARCHAR or BLOB column for the started block of rows.
+     *
+     * @param columnIndex 0-based index of the column
+     * @param data UTF-8 bytes of all the strings
+     * @param offsets value for row {@code i} is stored in {@code data} from {@code offsets[offset + i]}
+     *                (inclusive) to {@code offsets[offset + i + 1]} (exclusive)
+     * @param offset index of the offset for the first row of the block
+     * @param nullMask optional, row {@code i} is NULL if the bit {@code offset + i} of the mask is set
+     */
+    public void appendStringColumn(int columnIndex, byte[] data, int[] offsets, int offset, long[] nullMask)
+        throws SQLException {
+        DuckDBNative.duckdb_jdbc_appender_append_string_column(appender_ref, columnIndex, data, offsets, offset,
+                                                               nullMask);
+    }
+
+    /**
+     * Appends the block of rows started with {@link #beginColumns}.
+     */
+    public void endColumns() throws SQLException {
+        DuckDBNative.duckdb_jdbc_appender_end_columns(appender_ref);
+    }
+
     @SuppressWarnings("deprecation")
     protected void finalize() throws Throwable {
         close();
@@ -1,5 +1,6 @@
 package org.duckdb;
 
+import static java.nio.charset.StandardCharsets.UTF_8;
 import static java.time.temporal.ChronoUnit.*;
 import static org.duckdb.DuckDBTimestamp.*;
 
@@ -41,21 +42,28 @@ class DuckDBVector {
                                 .toFormatter())
             .toFormatter();
 
-    DuckDBVector(String duckdb_type, int length, boolean[] nullmask) {
+    DuckDBVector(String duckdb_type, int length, ByteBuffer validity) {
         super();
         this.duckdb_type = DuckDBResultSetMetaData.TypeNameToType(duckdb_type);
         this.meta = this.duckdb_type == DuckDBColumnType.DECIMAL
                         ? DuckDBColumnTypeMetaData.parseColumnTypeMetadata(duckdb_type)
                         : null;
         this.length = length;
-        this.nullmask = nullmask;
+        this.validity = validity != null ? validity.order(ByteOrder.LITTLE_ENDIAN) : null;
     }
     private final DuckDBColumnTypeMetaData meta;
     protected final DuckDBColumnType duckdb_type;
     final int length;
-    private final boolean[] nullmask;
+    // 64-bit words of the native validity mask, a cleared bit marks a NULL row,
+    // null when all rows are valid
+    private final ByteBuffer validity;
     private ByteBuffer constlen_data = null;
     private Object[] varlen_data = null;
+    // VARCHAR and BLOB values of all rows are passed as a single byte array,
+    // string for row i is stored at [string_offsets[i], string_offsets[i + 1])
+    private byte[] string_data = null;
+    private int[] string_offsets = null;
+    private String[] string_cache = null;
 
     Object getObject(int idx) throws SQLException {
         if (check_and_null(idx)) {
@@ -262,9 +270,29 @@ class DuckDBVector {
         if (check_and_null(idx)) {
             return null;
         }
+        if (string_data != null) {
+            return getStringFromData(idx);
+        }
         return varlen_data[idx].toString();
     }
 
+    private String getStringFromData(int idx) {
+        if (string_cache == null) {
+            string_cache = new String[length];
+        }
+        String str = string_cache[idx];
+        if (str == null) {
+            int start = string_offsets[idx];
+            str = new String(string_data, start, string_offsets[idx + 1] - start, UTF_8);
+            string_cache[idx] = str;
+        }
+        return str;
+    }
+
+    private byte[] getBytesFromData(int idx) {
+        return Arrays.copyOfRange(string_data, string_offsets[idx], string_offsets[idx + 1]);
+    }
+
     Array getArray(int idx) throws SQLException {
         if (check_and_null(idx)) {
             return null;
@@ -299,7 +327,7 @@ class DuckDBVector {
             return null;
         }
         if (isType(DuckDBColumnType.BLOB)) {
-            return new DuckDBResultSet.DuckDBBlobResult(ByteBuffer.wrap((byte[]) varlen_data[idx]));
+            return new DuckDBResultSet.DuckDBBlobResult(ByteBuffer.wrap(getBytesFromData(idx)));
         }
 
         throw new SQLFeatureNotSupportedException("getBlob");
@@ -311,7 +339,7 @@ class DuckDBVector {
         }
 
         if (isType(DuckDBColumnType.BLOB)) {
-            return (byte[]) varlen_data[idx];
+            return getBytesFromData(idx);
         }
 
         throw new SQLFeatureNotSupportedException("getBytes");
@@ -448,7 +476,14 @@ class DuckDBVector {
     }
 
     protected boolean check_and_null(int idx) {
-        return nullmask[idx];
+        if (idx < 0 || idx >= length) {
+            throw new ArrayIndexOutOfBoundsException(idx);
+        }
+        if (validity == null) {
+            return false;
+        }
+        long entry = validity.getLong((idx >>> 6) << 3);
+        return (entry & (1L << (idx & 63))) == 0;
     }
 
     long getLong(int idx) throws SQLException {
@@ -197,6 +197,43 @@ public class TestAppender {
         }
     }
 
+    public static void test_appender_mixed_strings_multiple_chunks() throws Exception {
+        try (DuckDBConnection conn = DriverManager.getConnection(JDBC_URL).unwrap(DuckDBConnection.class);
+             Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE tab1(col1 INT, col2 VARCHAR DEFAULT 'default value that is not inlined')");
+
+            int count = 5000;
+            String[] expected = new String[count];
+            try (DuckDBAppender appender = conn.createAppender("tab1")) {
+                for (int i = 0; i < count; i++) {
+                    appender.beginRow().append(i);
+                    if (i % 7 == 0) {
+                        appender.appendNull();
+                        expected[i] = null;
+                    } else if (i % 11 == 0) {
+                        appender.appendDefault();
+                        expected[i] = "default value that is not inlined";
+                    } else if (i % 3 == 0) {
+                        expected[i] = "short" + i;
+                        appender.append(expected[i]);
+                    } else {
+                        expected[i] = "long string value number " + i;
+                        appender.append(expected[i]);
+                    }
+                    appender.endRow();
+                }
+            }
+
+            try (ResultSet rs = stmt.executeQuery("SELECT col2 FROM tab1 ORDER BY col1")) {
+                for (int i = 0; i < count; i++) {
+                    assertTrue(rs.next());
+                    assertEquals(rs.getString(1), expected[i]);
+                }
+                assertFalse(rs.next());
+            }
+        }
+    }
+
     public static void test_appender_huge_integer() throws Exception {
         try (DuckDBConnection conn = DriverManager.getConnection(JDBC_URL).unwrap(DuckDBConnection.class);
              Statement stmt = conn.createStatement()) {
@@ -50,6 +50,68 @@ public class TestBatch {
         }
     }
 
+    public static void test_batch_prepared_statement_large() throws Exception {
+        int count = 5000;
+        try (Connection conn = DriverManager.getConnection(JDBC_URL)) {
+            try (Statement s = conn.createStatement()) {
+                s.execute("CREATE TABLE test (id BIGINT, name VARCHAR, val DOUBLE, flag BOOLEAN DEFAULT true)");
+            }
+            try (PreparedStatement ps = conn.prepareStatement("INSERT INTO test (val, id, name) VALUES (?, ?, ?)")) {
+                for (int i = 0; i < count; i++) {
+                    if (i % 10 == 0) {
+                        ps.setNull(1, Types.DOUBLE);
+                    } else {
+                        ps.setDouble(1, i / 2.0);
+                    }
+                    ps.setLong(2, i);
+                    ps.setString(3, i % 7 == 0 ? null : "name" + i);
+                    ps.addBatch();
+                }
+                long[] counts = ps.executeLargeBatch();
+                assertEquals(counts.length, count);
+                for (long c : counts) {
+                    assertEquals(c, 1L);
+                }
+            }
+            try (Statement s = conn.createStatement();
+                 ResultSet rs = s.executeQuery("SELECT * FROM test ORDER BY id")) {
+                for (int i = 0; i < count; i++) {
+                    assertTrue(rs.next());
+                    assertEquals(rs.getLong(1), (long) i);
+                    assertEquals(rs.getString(2), i % 7 == 0 ? null : "name" + i);
+                    assertEquals(rs.getObject(3), i % 10 == 0 ? null : i / 2.0);
+                    assertTrue(rs.getBoolean(4));
+                }
+                assertFalse(rs.next());
+            }
+
+            // not a plain INSERT, executed per batch entry
+            try (PreparedStatement ps = conn.prepareStatement("UPDATE test SET name = ? WHERE id < ?")) {
+                ps.setString(1, "foo");
+                ps.setLong(2, 10);
+                ps.addBatch();
+                ps.setString(1, "bar");
+                ps.setInt(2, 5);
+                ps.addBatch();
+                long[] counts = ps.executeLargeBatch();
+                assertEquals(counts.length, 2);
+                assertEquals(counts[0], 10L);
+                assertEquals(counts[1], 5L);
+            }
+            try (Statement s = conn.createStatement();
+                 ResultSet rs = s.executeQuery(
+                     "SELECT name, count(*) FROM test WHERE id < 10 GROUP BY name ORDER BY name")) {
+                assertTrue(rs.next());
+                assertEquals(rs.getString(1), "bar");
+                assertEquals(rs.getLong(2), 5L);
+                assertTrue(rs.next());
+                assertEquals(rs.getString(1), "foo");
+                assertEquals(rs.getLong(2), 5L);
+                assertFalse(rs.next());
+            }
+        }
+    }
+
     public static void test_batch_statement() throws Exception {
         try (Connection conn = DriverManager.getConnection(JDBC_URL)) {
             try (Statement s = conn.createStatement()) {
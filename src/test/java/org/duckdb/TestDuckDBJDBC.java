@@ -23,6 +23,7 @@ import java.nio.ByteBuffer;
 import java.nio.charset.StandardCharsets;
 import java.nio.file.Files;
 import java.nio.file.Path;
+import java.nio.file.Paths;
 import java.sql.*;
 import java.time.*;
 import java.time.format.DateTimeFormatter;
@@ -41,11 +42,14 @@ import java.util.Properties;
 import java.util.TimeZone;
 import java.util.UUID;
 import java.util.concurrent.Callable;
+import java.util.concurrent.CountDownLatch;
 import java.util.concurrent.ExecutorService;
 import java.util.concurrent.Executors;
 import java.util.concurrent.Future;
 import java.util.concurrent.TimeUnit;
 import java.util.logging.Logger;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
 import javax.sql.rowset.CachedRowSet;
 import javax.sql.rowset.RowSetProvider;
 
@@ -629,6 +633,906 @@ public class TestDuckDBJDBC {
         }
     }
 
+    public static void test_read_ahead_threads() throws Exception {
+        Path database_file = Files.createTempFile("duckdb-read-ahead-test-", ".duckdb");
+        Files.deleteIfExists(database_file);
+        String jdbc_url = JDBC_URL + database_file;
+
+        try (Connection conn = DriverManager.getConnection(jdbc_url); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE test AS SELECT i, i::VARCHAR s FROM range(1000000) t(i)");
+            stmt.execute("CHECKPOINT");
+        }
+
+        Properties config = new Properties();
+        config.setProperty("read_ahead_threads", "2");
+        try (Connection conn = DriverManager.getConnection(jdbc_url, config); Statement stmt = conn.createStatement()) {
+            try (ResultSet rs = stmt.executeQuery("SELECT current_setting('read_ahead_threads')")) {
+                assertTrue(rs.next());
+                assertEquals(rs.getLong(1), 2L);
+            }
+            stmt.execute("SET enable_logging = true");
+            stmt.execute("SET logging_level = 'debug'");
+            try (ResultSet rs = stmt.executeQuery("SELECT sum(i), count(s) FROM test WHERE i % 7 = 0")) {
+                assertTrue(rs.next());
+                assertEquals(rs.getLong(1), 71428928571L);
+                assertEquals(rs.getLong(2), 142858L);
+            }
+            // the read-ahead threads loaded the blocks of the following row groups, they may log after the scan
+            String readAheadLogs = "SELECT count(*) FROM duckdb_logs WHERE message LIKE 'BlockReadAhead loaded %'";
+            for (int i = 0; i < 100 && countRows(stmt, readAheadLogs) == 0; i++) {
+                Thread.sleep(50);
+            }
+            assertTrue(countRows(stmt, readAheadLogs) > 0);
+        } finally {
+            Files.deleteIfExists(database_file);
+        }
+    }
+
+    private static void assertIOUringTestSums(Statement stmt) throws Exception {
+        try (ResultSet rs = stmt.executeQuery("SELECT sum(i), count(s) FROM test")) {
+            assertTrue(rs.next());
+            assertEquals(rs.getLong(1), 499999500000L);
+            assertEquals(rs.getLong(2), 1000000L);
+        }
+    }
+
+    private static long waitForLogs(Statement stmt, String messagePattern) throws Exception {
+        // background threads may write their log entries after the query that triggered them
+        String query = "SELECT count(*) FROM duckdb_logs WHERE message LIKE '" + messagePattern + "'";
+        for (int i = 0; i < 100 && countRows(stmt, query) == 0; i++) {
+            Thread.sleep(50);
+        }
+        return countRows(stmt, query);
+    }
+
+    private static Connection openIOUringTestConnection(String jdbc_url) throws Exception {
+        // the table scans themselves only prefetch from remote files, the read-ahead threads batch the reads of the
+        // next row group through io_uring
+        Properties config = new Properties();
+        config.setProperty("read_ahead_threads", "2");
+        Connection conn = DriverManager.getConnection(jdbc_url, config);
+        try (Statement stmt = conn.createStatement()) {
+            stmt.execute("SET enable_logging = true");
+            stmt.execute("SET logging_level = 'debug'");
+        }
+        return conn;
+    }
+
+    public static void test_io_uring_read_failure() throws Exception {
+        if (!System.getProperty("os.name").toLowerCase().contains("linux")) {
+            return;
+        }
+        Path database_file = Files.createTempFile("duckdb-io-uring-test-", ".duckdb");
+        Files.deleteIfExists(database_file);
+        String jdbc_url = JDBC_URL + database_file;
+        String batchReadLogs = "SELECT count(*) FROM duckdb_logs WHERE message LIKE 'SingleFileBlockManager read %'";
+        String failedReadAheadLogs = "SELECT count(*) FROM duckdb_logs WHERE message LIKE 'BlockReadAhead failed%'";
+
+        try (Connection conn = DriverManager.getConnection(jdbc_url); Statement stmt = conn.createStatement()) {
+            // the blocks of the pad column separate the blocks of i and s, so the read-ahead reads several ranges
+            stmt.execute("CREATE TABLE test AS SELECT i, md5(i::VARCHAR) pad, i::VARCHAR s FROM range(1000000) t(i)");
+            stmt.execute("CHECKPOINT");
+        }
+
+        try {
+            try (Connection conn = openIOUringTestConnection(jdbc_url); Statement stmt = conn.createStatement()) {
+                assertIOUringTestSums(stmt);
+                assertTrue(waitForLogs(stmt, "BlockReadAhead loaded %") > 0);
+                if (countRows(stmt, batchReadLogs) == 0) {
+                    // io_uring is not available on this system (e.g. it is blocked by seccomp)
+                    return;
+                }
+            }
+
+            // reads that io_uring does not accept fall back to regular reads
+            try (Connection conn = openIOUringTestConnection(jdbc_url); Statement stmt = conn.createStatement()) {
+                stmt.execute("SET debug_io_uring_failure = 'submit'");
+                try {
+                    assertIOUringTestSums(stmt);
+                    assertTrue(waitForLogs(stmt, "BlockReadAhead loaded %") > 0);
+                    assertEquals(countRows(stmt, failedReadAheadLogs), 0L);
+                } finally {
+                    stmt.execute("RESET debug_io_uring_failure");
+                }
+            }
+
+            // reads that fail while they are in flight are waited for before the error is raised; the read-ahead
+            // drops the blocks and the scan loads them itself
+            try (Connection conn = openIOUringTestConnection(jdbc_url); Statement stmt = conn.createStatement()) {
+                stmt.execute("SET debug_io_uring_failure = 'wait'");
+                try {
+                    assertIOUringTestSums(stmt);
+                    assertTrue(
+                        waitForLogs(stmt, "BlockReadAhead failed: Could not wait for io_uring reads to complete%") > 0);
+                } finally {
+                    stmt.execute("RESET debug_io_uring_failure");
+                }
+            }
+
+            // the failed batches did not leave completions behind on the rings of the read-ahead threads
+            try (Connection conn = openIOUringTestConnection(jdbc_url); Statement stmt = conn.createStatement()) {
+                assertIOUringTestSums(stmt);
+                assertTrue(waitForLogs(stmt, "BlockReadAhead loaded %") > 0);
+                assertTrue(countRows(stmt, batchReadLogs) > 0);
+                assertEquals(countRows(stmt, failedReadAheadLogs), 0L);
+                assertIOUringTestSums(stmt);
+            }
+        } finally {
+            Files.deleteIfExists(database_file);
+        }
+    }
+
+    public static void test_ordered_aggregates() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            // flush the sorts of the ordered aggregates multiple times
+            stmt.execute("SET ordered_aggregate_threshold=1000");
+            try (ResultSet rs = stmt.executeQuery(
+                     "SELECT i % 10 AS g, first(i ORDER BY i DESC), last(i ORDER BY i DESC), "
+                     + "first(i::VARCHAR ORDER BY i::VARCHAR), string_agg(i::VARCHAR, ',' ORDER BY i DESC) "
+                     + "FROM range(100000) t(i) GROUP BY g ORDER BY g")) {
+                for (long g = 0; g < 10; g++) {
+                    assertTrue(rs.next());
+                    assertEquals(rs.getLong(1), g);
+                    assertEquals(rs.getLong(2), 99990 + g);
+                    assertEquals(rs.getLong(3), g);
+                    assertEquals(rs.getString(4), Long.toString(g));
+                    assertTrue(rs.getString(5).startsWith((99990 + g) + "," + (99980 + g) + ","));
+                }
+                assertFalse(rs.next());
+            }
+        }
+    }
+
+    public static void test_window_argument_orders() throws Exception {
+        // many small sorted partitions, then a single thread
+        String[] setups = {"PRAGMA verify_parallelism", "SET threads=1"};
+        for (String setup : setups) {
+            try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+                stmt.execute(setup);
+                try (ResultSet rs = stmt.executeQuery(
+                         "SELECT count(*) FILTER (WHERE r = x * 100 + 1), count(DISTINCT rs), max(rs), sum(rn), "
+                         + "count(*) FILTER (WHERE fv % 1000 = 999) FROM (SELECT i % 1000 AS x, "
+                         + "rank(ORDER BY i % 1000) OVER () AS r, "
+                         + "rank(ORDER BY (i % 1000)::VARCHAR) OVER () AS rs, "
+                         + "row_number(ORDER BY i % 1000 DESC) OVER () AS rn, "
+                         + "first_value(i ORDER BY i % 1000 DESC) OVER () AS fv FROM range(100000) t(i))")) {
+                    assertTrue(rs.next());
+                    assertEquals(rs.getLong(1), 100000L);
+                    assertEquals(rs.getLong(2), 1000L);
+                    assertEquals(rs.getLong(3), 99901L);
+                    assertEquals(rs.getLong(4), 5000050000L);
+                    assertEquals(rs.getLong(5), 100000L);
+                }
+            }
+        }
+    }
+
+    private static void assertVectorZonemapScan(Statement stmt, String query, long expected) throws SQLException {
+        stmt.execute("SET enable_logging = true");
+        stmt.execute("SET logging_level = 'trace'");
+        stmt.execute("PRAGMA truncate_duckdb_logs");
+        assertEquals(countRows(stmt, query), expected);
+        // v = 42 only occurs in vectors 1 and 2 (rows 2048 - 6143), the other 46 complete vectors are skipped
+        // the last vector (rows 98304 - 100000) is not complete and has no zone
+        String skipped = "SELECT count(*) FROM duckdb_logs WHERE message LIKE 'RowGroup skipped vector %'";
+        assertEquals(countRows(stmt, skipped), 46L);
+        assertEquals(countRows(stmt, skipped + " AND regexp_matches(message, 'vector (1|2|48) ')"), 0L);
+        stmt.execute("SET enable_logging = false");
+    }
+
+    public static void test_vector_zonemaps() throws Exception {
+        Path database_file = Files.createTempFile("duckdb-vector-zonemap-test-", ".duckdb");
+        Files.deleteIfExists(database_file);
+        String jdbc_url = JDBC_URL + database_file;
+
+        long expected = 1;
+        for (long i = 0; i < 100000; i++) {
+            if (i / 100 + i % 7 == 42) {
+                expected++;
+            }
+        }
+        String query = "SELECT count(*) FROM test WHERE v = 42";
+        try (Connection conn = DriverManager.getConnection(jdbc_url); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE test AS SELECT i, i // 100 + i % 7 AS v, 's' || (i // 2048) AS s "
+                         + "FROM range(100000) t(i)");
+            stmt.execute("CHECKPOINT");
+            // append to the last vector of the checkpointed row group
+            stmt.execute("INSERT INTO test VALUES (100000, 42, 's10')");
+            assertVectorZonemapScan(stmt, query, expected);
+        }
+        // the zones are kept in memory only, the first scan after loading the table rebuilds them
+        try (Connection conn = DriverManager.getConnection(jdbc_url); Statement stmt = conn.createStatement()) {
+            assertVectorZonemapScan(stmt, query, expected);
+            assertEquals(countRows(stmt, "SELECT count(*) FROM test WHERE s = 's10'"), 2049L);
+        }
+
+        // rebuild the zones while other connections append to the vectors after the persistent rows
+        for (int run = 0; run < 5; run++) {
+            try (Connection conn = DriverManager.getConnection(jdbc_url);
+                 Connection append_conn = conn.unwrap(DuckDBConnection.class).duplicate();
+                 Statement stmt = conn.createStatement()) {
+                ExecutorService executor = Executors.newSingleThreadExecutor();
+                try {
+                    Future<Long> appended = executor.submit(() -> {
+                        try (Statement append_stmt = append_conn.createStatement()) {
+                            long rows = 0;
+                            for (int i = 0; i < 50; i++) {
+                                append_stmt.execute("INSERT INTO test SELECT i, 42, 'appended' FROM range(100) t(i)");
+                                rows += 100;
+                            }
+                            return rows;
+                        }
+                    });
+                    while (!appended.isDone()) {
+                        assertTrue(countRows(stmt, query) >= expected);
+                    }
+                    expected += appended.get();
+                } finally {
+                    executor.shutdown();
+                }
+                // no zone covers the appended rows
+                assertEquals(countRows(stmt, query), expected);
+            }
+        }
+        try (Connection conn = DriverManager.getConnection(jdbc_url); Statement stmt = conn.createStatement()) {
+            assertEquals(countRows(stmt, query), expected);
+        } finally {
+            Files.deleteIfExists(database_file);
+        }
+    }
+
+    private static long countRows(Statement stmt, String query) throws SQLException {
+        try (ResultSet rs = stmt.executeQuery(query)) {
+            assertTrue(rs.next());
+            return rs.getLong(1);
+        }
+    }
+
+    // largest number of rows emitted by a table scan in the JSON profile of the last query
+    private static long maxTableScanCardinality(DuckDBConnection conn) throws SQLException {
+        String profile = conn.getProfilingInformation(ProfilerPrintFormat.JSON);
+        Pattern cardinality = Pattern.compile("\"operator_cardinality\": (\\d+)");
+        long result = -1;
+        // the metrics of an operator are written before its children
+        for (String op : profile.split("\"children\"")) {
+            if (op.contains("\"TABLE_SCAN\"")) {
+                Matcher m = cardinality.matcher(op);
+                assertTrue(m.find());
+                result = Math.max(result, Long.parseLong(m.group(1)));
+            }
+        }
+        return result;
+    }
+
+    public static void test_hash_join_bloom_filter() throws Exception {
+        try (DuckDBConnection conn = DriverManager.getConnection(JDBC_URL).unwrap(DuckDBConnection.class);
+             Statement stmt = conn.createStatement()) {
+            // sparse build keys: too many for an IN filter and not dense enough for the min/max range filter
+            stmt.execute("CREATE TABLE probe AS SELECT i AS k FROM range(1000000) t(i)");
+            stmt.execute("CREATE TABLE build AS SELECT i * 1000 + 7 AS k FROM range(5000) t(i)");
+            stmt.execute("SET enable_profiling = 'no_output'");
+            assertEquals(countRows(stmt, "SELECT count(*) FROM probe JOIN build USING (k)"), 1000L);
+            // without the Bloom filter the probe-side scan emits all its rows
+            assertTrue(maxTableScanCardinality(conn) < 100000);
+            stmt.execute("PRAGMA disable_profiling");
+
+            // keys of different types, with NULLs on both sides
+            String[] keys = new String[] {"%s::VARCHAR",
+                                          "%s::DOUBLE",
+                                          "DATE '2000-01-01' + %s::INTEGER",
+                                          "%s::HUGEINT * 1000000000000::HUGEINT * 1000000000::HUGEINT",
+                                          "%s::DECIMAL(18, 3) * 0.125",
+                                          "{'a': %s}"};
+            long matches = 0;
+            for (int j = 0; j < 10000; j++) {
+                if (j % 100 != 0 && 37 * j < 200000 && (37 * j) % 10 != 0) {
+                    matches++;
+                }
+            }
+            for (String key : keys) {
+                stmt.execute("CREATE OR REPLACE TABLE probe AS SELECT CASE WHEN i % 10 = 0 THEN NULL ELSE " +
+                             String.format(key, "i") + " END AS k FROM range(200000) t(i)");
+                stmt.execute("CREATE OR REPLACE TABLE build AS SELECT CASE WHEN i % 100 = 0 THEN NULL ELSE " +
+                             String.format(key, "(i * 37)") + " END AS k FROM range(10000) t(i)");
+                assertEquals(countRows(stmt, "SELECT count(*) FROM probe JOIN build USING (k)"), matches, key);
+                // NULL keys are equal for IS NOT DISTINCT FROM, these joins do not use the Bloom filter
+                String not_distinct = "SELECT count(*) FROM probe p JOIN build b ON p.k IS NOT DISTINCT FROM b.k";
+                assertEquals(countRows(stmt, not_distinct), matches + 20000L * 100L, key);
+            }
+        }
+    }
+
+    // the number of row groups that a count query skipped with a Bloom filter, out of those starting at the given rows
+    private static long countBloomFilterSkips(Statement stmt, String query, long expected, long... row_group_starts)
+        throws SQLException {
+        stmt.execute("PRAGMA truncate_duckdb_logs");
+        assertEquals(countRows(stmt, query), expected);
+        long skipped = 0;
+        for (long start : row_group_starts) {
+            skipped += countRows(stmt, "SELECT count(DISTINCT message) FROM duckdb_logs WHERE message LIKE "
+                                           + "'RowGroup skipped the row group starting at row " + start + " %'");
+        }
+        return skipped;
+    }
+
+    // lookups of ten values that are not in the table, within the min/max range of its k column
+    private static long countAbsentBloomFilterSkips(Statement stmt, long... row_group_starts) throws SQLException {
+        long skipped = 0;
+        for (int j = 0; j < 10; j++) {
+            String query = "SELECT count(*) FROM test WHERE k = md5('absent" + j + "')";
+            skipped += countBloomFilterSkips(stmt, query, 0L, row_group_starts);
+        }
+        return skipped;
+    }
+
+    private static Connection openBloomFilterTestConnection(String jdbc_url) throws SQLException {
+        Properties config = new Properties();
+        config.setProperty("storage_compatibility_version", "latest");
+        Connection conn = DriverManager.getConnection(jdbc_url, config);
+        try (Statement stmt = conn.createStatement()) {
+            stmt.execute("SET enable_logging = true");
+            stmt.execute("SET logging_level = 'trace'");
+        }
+        return conn;
+    }
+
+    public static void test_row_group_bloom_filters() throws Exception {
+        Path database_file = Files.createTempFile("duckdb-bloom-filter-test-", ".duckdb");
+        Files.deleteIfExists(database_file);
+        String jdbc_url = JDBC_URL + database_file;
+
+        // the declarations are logged as alters that older versions cannot replay
+        try (Connection conn = DriverManager.getConnection(jdbc_url); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE test (id BIGINT, k VARCHAR)");
+            assertThrows(() -> stmt.execute("PRAGMA create_bloom_filter('test', 'k')"), SQLException.class);
+        }
+        Files.deleteIfExists(database_file);
+
+        try (Connection conn = openBloomFilterTestConnection(jdbc_url); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE SCHEMA other");
+            stmt.execute("CREATE TABLE test (id BIGINT, k VARCHAR)");
+            stmt.execute("CREATE TABLE other.test (id BIGINT, k VARCHAR, d DOUBLE)");
+            stmt.execute("PRAGMA create_bloom_filter('main.test', 'k')");
+            stmt.execute("PRAGMA create_bloom_filter('test', 'id')");
+            assertThrows(() -> stmt.execute("PRAGMA create_bloom_filter('other.test', 'd')"), SQLException.class);
+            assertThrows(() -> stmt.execute("PRAGMA create_bloom_filter('missing', 'k')"), SQLException.class);
+        }
+        // the declarations are stored with the table in the catalog
+        try (Connection conn = openBloomFilterTestConnection(jdbc_url); Statement stmt = conn.createStatement()) {
+            // row groups start at rows 0, 122880 and 245760
+            stmt.execute("INSERT INTO test SELECT i, md5(i::VARCHAR) FROM range(300000) t(i)");
+            stmt.execute("INSERT INTO other.test SELECT i, md5(i::VARCHAR), i FROM range(1000) t(i)");
+            stmt.execute("CHECKPOINT");
+            // the row group that holds the value is never skipped
+            assertEquals(countBloomFilterSkips(stmt, "SELECT count(*) FROM test WHERE k = md5('12345')", 1L, 0), 0L);
+            // the others are, apart from false positives
+            assertTrue(countAbsentBloomFilterSkips(stmt, 0, 122880, 245760) >= 25);
+            assertEquals(countRows(stmt, "SELECT count(*) FROM test WHERE k IN (md5('1'), md5('250000'), 'x')"), 2L);
+            assertEquals(countRows(stmt, "SELECT count(*) FROM test WHERE id = 299999 OR id = 7"), 2L);
+
+            // updated and appended values are not in the Bloom filters
+            stmt.execute("UPDATE test SET k = 'updated' WHERE id = 5");
+            stmt.execute("INSERT INTO test VALUES (300000, 'appended')");
+            assertEquals(countRows(stmt, "SELECT count(*) FROM test WHERE k = 'updated'"), 1L);
+            assertEquals(countRows(stmt, "SELECT count(*) FROM test WHERE k = 'appended'"), 1L);
+            stmt.execute("CHECKPOINT");
+        }
+        try {
+            // the Bloom filters are read back with the row groups
+            try (Connection conn = openBloomFilterTestConnection(jdbc_url); Statement stmt = conn.createStatement()) {
+                assertTrue(countAbsentBloomFilterSkips(stmt, 0, 122880, 245760) >= 25);
+                assertEquals(countRows(stmt, "SELECT count(*) FROM test WHERE k = 'updated'"), 1L);
+                assertEquals(countRows(stmt, "SELECT count(*) FROM test WHERE k = 'appended'"), 1L);
+                assertEquals(countRows(stmt, "SELECT count(*) FROM test WHERE k = md5('5')"), 0L);
+                assertEquals(countRows(stmt, "SELECT count(*) FROM test WHERE k = md5('123456')"), 1L);
+                assertEquals(countRows(stmt, "SELECT count(*) FROM other.test WHERE k = md5('12')"), 1L);
+
+                // the last row group is rewritten without a Bloom filter, the others keep theirs
+                stmt.execute("PRAGMA drop_bloom_filter('main.test', 'k')");
+                stmt.execute("INSERT INTO test VALUES (300001, 'unfiltered')");
+                stmt.execute("CHECKPOINT");
+                assertEquals(countRows(stmt, "SELECT count(*) FROM test WHERE k = 'unfiltered'"), 1L);
+                assertEquals(countAbsentBloomFilterSkips(stmt, 245760), 0L);
+                assertTrue(countAbsentBloomFilterSkips(stmt, 0, 122880) >= 15);
+            }
+            // the dropped declaration is persisted as well
+            try (Connection conn = openBloomFilterTestConnection(jdbc_url); Statement stmt = conn.createStatement()) {
+                stmt.execute("INSERT INTO test VALUES (300002, 'unfiltered')");
+                stmt.execute("CHECKPOINT");
+                assertEquals(countRows(stmt, "SELECT count(*) FROM test WHERE k = 'unfiltered'"), 2L);
+                assertEquals(countAbsentBloomFilterSkips(stmt, 245760), 0L);
+            }
+        } finally {
+            Files.deleteIfExists(database_file);
+        }
+    }
+
+    public static void test_background_checkpoint() throws Exception {
+        Path database_file = Files.createTempFile("duckdb-background-checkpoint-test-", ".duckdb");
+        Files.deleteIfExists(database_file);
+        String jdbc_url = JDBC_URL + database_file;
+        Path wal_file = Paths.get(database_file + ".wal");
+        Properties config = new Properties();
+        config.setProperty("background_checkpoint", "true");
+        config.setProperty("checkpoint_threshold", "16KB");
+        config.setProperty("threads", "4");
+
+        try (Connection conn = DriverManager.getConnection(jdbc_url, config); Statement stmt = conn.createStatement()) {
+            try (ResultSet rs = stmt.executeQuery("SELECT current_setting('background_checkpoint')")) {
+                assertTrue(rs.next());
+                assertTrue(rs.getBoolean(1));
+            }
+            stmt.execute("CREATE TABLE test (id INTEGER, v VARCHAR)");
+            // every commit crosses the checkpoint threshold and schedules a checkpoint instead of running it
+            for (int i = 0; i < 50; i++) {
+                stmt.execute("INSERT INTO test SELECT i, md5(i::VARCHAR) FROM range(" + (i * 1000) + ", " +
+                             ((i + 1) * 1000) + ") t(i)");
+            }
+            stmt.execute("UPDATE test SET v = 'updated' WHERE id % 1000 = 0");
+            assertEquals(countRows(stmt, "SELECT count(*) FROM test"), 50000L);
+
+            // the WAL only drops below the threshold once a background checkpoint has truncated it
+            stmt.execute("CREATE TABLE ticks (i INTEGER)");
+            boolean checkpointed = false;
+            for (int i = 0; i < 1000 && !checkpointed; i++) {
+                stmt.execute("INSERT INTO ticks VALUES (" + i + ")");
+                checkpointed = wal_file.toFile().length() < 16 * 1024;
+                if (!checkpointed) {
+                    Thread.sleep(10);
+                }
+            }
+            assertTrue(checkpointed);
+        }
+        try (Connection conn = DriverManager.getConnection(jdbc_url, config); Statement stmt = conn.createStatement()) {
+            assertEquals(countRows(stmt, "SELECT count(*) FROM test"), 50000L);
+            assertEquals(countRows(stmt, "SELECT count(*) FROM test WHERE v = 'updated'"), 50L);
+            assertEquals(countRows(stmt, "SELECT count(*) FROM test WHERE v = md5('49999')"), 1L);
+        }
+
+        // a failing background checkpoint fails the following commits instead of being ignored
+        Properties abort_config = new Properties();
+        abort_config.putAll(config);
+        abort_config.setProperty("debug_checkpoint_abort", "before_header");
+        long appended = 0;
+        try (Connection conn = DriverManager.getConnection(jdbc_url, abort_config);
+             Statement stmt = conn.createStatement()) {
+            for (int i = 0; i < 1000; i++) {
+                try {
+                    stmt.execute("INSERT INTO test SELECT i, 'appended' FROM range(1000) t(i)");
+                } catch (SQLException e) {
+                    break;
+                }
+                appended += 1000;
+            }
+        }
+        assertTrue(appended < 1000L * 1000L);
+
+        // every successful commit survives, including the ones written while the checkpoint was running
+        try (Connection conn = DriverManager.getConnection(jdbc_url, config); Statement stmt = conn.createStatement()) {
+            assertEquals(countRows(stmt, "SELECT count(*) FROM test"), 50000L + appended);
+            assertEquals(countRows(stmt, "SELECT count(*) FROM test WHERE v = 'appended'"), appended);
+        }
+        try {
+            assertFalse(Files.exists(wal_file));
+            assertFalse(Files.exists(Paths.get(database_file + ".wal.next")));
+        } finally {
+            Files.deleteIfExists(database_file);
+            Files.deleteIfExists(wal_file);
+            Files.deleteIfExists(Paths.get(database_file + ".wal.next"));
+        }
+    }
+
+    public static void test_background_checkpoint_force_checkpoint() throws Exception {
+        Path database_file = Files.createTempFile("duckdb-background-force-checkpoint-test-", ".duckdb");
+        Files.deleteIfExists(database_file);
+        String jdbc_url = JDBC_URL + database_file;
+        Properties config = new Properties();
+        config.setProperty("background_checkpoint", "true");
+
+        // inserts that span multiple row groups write them to disk while FORCE CHECKPOINT runs concurrently
+        long expected_sum = 0;
+        try (Connection conn = DriverManager.getConnection(jdbc_url, config);
+             Connection checkpoint_conn = conn.unwrap(DuckDBConnection.class).duplicate();
+             Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE test (i BIGINT, v VARCHAR)");
+            ExecutorService executor = Executors.newSingleThreadExecutor();
+            try {
+                Future<Long> checkpoints = executor.submit(() -> {
+                    try (Statement checkpoint_stmt = checkpoint_conn.createStatement()) {
+                        long count = 0;
+                        for (int i = 0; i < 20; i++) {
+                            checkpoint_stmt.execute("FORCE CHECKPOINT");
+                            count++;
+                        }
+                        return count;
+                    }
+                });
+                for (int i = 0; i < 3; i++) {
+                    stmt.execute("INSERT INTO test SELECT i, md5(i::VARCHAR) FROM range(2000000) t(i)");
+                    expected_sum += 1999999L * 2000000L / 2;
+                }
+                assertEquals(checkpoints.get(), 20L);
+            } finally {
+                executor.shutdown();
+            }
+            assertEquals(countRows(stmt, "SELECT count(*) FROM test"), 6000000L);
+            assertEquals(countRows(stmt, "SELECT sum(i) FROM test"), expected_sum);
+            assertEquals(countRows(stmt, "SELECT count(*) FROM test WHERE v = md5(i::VARCHAR)"), 6000000L);
+        }
+        try (Connection conn = DriverManager.getConnection(jdbc_url, config); Statement stmt = conn.createStatement()) {
+            assertEquals(countRows(stmt, "SELECT count(*) FROM test"), 6000000L);
+            assertEquals(countRows(stmt, "SELECT sum(i) FROM test"), expected_sum);
+            assertEquals(countRows(stmt, "SELECT count(*) FROM test WHERE v = md5(i::VARCHAR)"), 6000000L);
+        } finally {
+            Files.deleteIfExists(database_file);
+            Files.deleteIfExists(Paths.get(database_file + ".wal"));
+        }
+    }
+
+    public static void test_background_checkpoint_recovery() throws Exception {
+        for (String abort : new String[] {"before_header", "before_truncate"}) {
+            Path database_file = Files.createTempFile("duckdb-background-checkpoint-recovery-test-", ".duckdb");
+            Files.deleteIfExists(database_file);
+            String jdbc_url = JDBC_URL + database_file;
+            Path wal_file = Paths.get(database_file + ".wal");
+            Path next_wal_file = Paths.get(database_file + ".wal.next");
+            Properties config = new Properties();
+            config.setProperty("background_checkpoint", "true");
+            config.setProperty("checkpoint_threshold", "1MB");
+
+            try (Connection conn = DriverManager.getConnection(jdbc_url); Statement stmt = conn.createStatement()) {
+                stmt.execute("CREATE TABLE a_small (i INTEGER)");
+                stmt.execute("CREATE TABLE z_big AS SELECT i, md5(i::VARCHAR) AS v FROM range(2000000) t(i)");
+            }
+
+            // the checkpoint triggered by the update writes a_small before z_big, so appends to a_small commit into
+            // the new WAL while z_big is rewritten - then the checkpoint crashes
+            Properties abort_config = new Properties();
+            abort_config.putAll(config);
+            abort_config.setProperty("debug_checkpoint_abort", abort);
+            long appended = 0;
+            try (Connection conn = DriverManager.getConnection(jdbc_url, abort_config);
+                 Connection append_conn = conn.unwrap(DuckDBConnection.class).duplicate();
+                 Statement stmt = conn.createStatement()) {
+                ExecutorService executor = Executors.newSingleThreadExecutor();
+                try {
+                    Future<Long> appends = executor.submit(() -> {
+                        try (Statement append_stmt = append_conn.createStatement()) {
+                            long rows = 0;
+                            for (int i = 0; i < 1000000; i++) {
+                                try {
+                                    append_stmt.execute("INSERT INTO a_small VALUES (" + i + ")");
+                                } catch (SQLException e) {
+                                    break;
+                                }
+                                rows++;
+                            }
+                            return rows;
+                        }
+                    });
+                    stmt.execute("UPDATE z_big SET v = 'updated'");
+                    appended = appends.get();
+                } finally {
+                    executor.shutdown();
+                }
+            }
+            assertTrue(appended < 1000000L);
+            assertTrue(Files.exists(wal_file));
+            assertTrue(Files.exists(next_wal_file));
+
+            // both WALs are replayed: the update from the rotated WAL (unless the checkpoint header was written) and
+            // the appends that were committed into the new WAL
+            try (Connection conn = DriverManager.getConnection(jdbc_url, config);
+                 Statement stmt = conn.createStatement()) {
+                assertEquals(countRows(stmt, "SELECT count(*) FROM a_small"), appended);
+                assertEquals(countRows(stmt, "SELECT count(DISTINCT i) FROM a_small"), appended);
+                assertEquals(countRows(stmt, "SELECT count(*) FROM z_big WHERE v = 'updated'"), 2000000L);
+                stmt.execute("CHECKPOINT");
+            }
+            try {
+                assertFalse(Files.exists(next_wal_file));
+                try (Connection conn = DriverManager.getConnection(jdbc_url, config);
+                     Statement stmt = conn.createStatement()) {
+                    assertEquals(countRows(stmt, "SELECT count(*) FROM a_small"), appended);
+                    assertEquals(countRows(stmt, "SELECT count(*) FROM z_big WHERE v = 'updated'"), 2000000L);
+                }
+            } finally {
+                Files.deleteIfExists(database_file);
+                Files.deleteIfExists(wal_file);
+                Files.deleteIfExists(next_wal_file);
+            }
+        }
+    }
+
+    public static void test_compressed_segment_filters() throws Exception {
+        Path database_file = Files.createTempFile("duckdb-compressed-filter-test-", ".duckdb");
+        Files.deleteIfExists(database_file);
+        String jdbc_url = JDBC_URL + database_file;
+
+        String[] compressions = new String[] {"bitpacking", "alp", "alprd", "dictionary"};
+        try (Connection conn = DriverManager.getConnection(jdbc_url); Statement stmt = conn.createStatement()) {
+            for (String compression : compressions) {
+                stmt.execute("SET force_compression='" + compression + "'");
+                stmt.execute("CREATE TABLE test_" + compression +
+                             " AS SELECT i, i / 10 AS d, (i % 10)::VARCHAR AS s FROM range(100000) t(i)");
+                stmt.execute("CHECKPOINT");
+            }
+            stmt.execute("SET force_compression='auto'");
+
+            for (String compression : compressions) {
+                String table = "test_" + compression;
+                try (ResultSet rs = stmt.executeQuery("SELECT count(*), sum(i) FROM " + table +
+                                                      " WHERE i BETWEEN 1000 AND 1999")) {
+                    assertTrue(rs.next());
+                    assertEquals(rs.getLong(1), 1000L);
+                    assertEquals(rs.getLong(2), 1499500L);
+                }
+                try (ResultSet rs =
+                         stmt.executeQuery("SELECT count(*) FROM " + table + " WHERE d >= 100 AND d < 200")) {
+                    assertTrue(rs.next());
+                    assertEquals(rs.getLong(1), 1000L);
+                }
+                try (ResultSet rs = stmt.executeQuery("SELECT count(*) FROM " + table + " WHERE d = 5000.5")) {
+                    assertTrue(rs.next());
+                    assertEquals(rs.getLong(1), 1L);
+                }
+                try (ResultSet rs = stmt.executeQuery("SELECT count(*) FROM " + table + " WHERE s = '3'")) {
+                    assertTrue(rs.next());
+                    assertEquals(rs.getLong(1), 10000L);
+                }
+            }
+        } finally {
+            Files.deleteIfExists(database_file);
+        }
+    }
+
+    public static void test_pin_threads_numa() throws Exception {
+        Properties config = new Properties();
+        config.setProperty("pin_threads", "numa");
+        config.setProperty("threads", "4");
+        try (Connection conn = DriverManager.getConnection(JDBC_URL, config); Statement stmt = conn.createStatement()) {
+            try (ResultSet rs = stmt.executeQuery("SELECT current_setting('pin_threads')")) {
+                assertTrue(rs.next());
+                assertEquals(rs.getString(1), "numa");
+            }
+            String query = "SELECT count(*), sum(c) FROM (SELECT count(*) c FROM range(1000000) GROUP BY range % 1000)";
+            try (ResultSet rs = stmt.executeQuery(query)) {
+                assertTrue(rs.next());
+                assertEquals(rs.getLong(1), 1000L);
+                assertEquals(rs.getLong(2), 1000000L);
+            }
+            // relaunching the threads keeps them pinned to the NUMA nodes
+            stmt.execute("SET threads = 2");
+            try (ResultSet rs = stmt.executeQuery("SELECT sum(i) FROM range(1000000) t(i)")) {
+                assertTrue(rs.next());
+                assertEquals(rs.getLong(1), 499999500000L);
+            }
+        }
+    }
+
+    public static void test_scheduler_fair_queuing() throws Exception {
+        Properties config = new Properties();
+        config.setProperty("scheduler_fair_queuing", "true");
+        config.setProperty("threads", "4");
+        try (Connection conn = DriverManager.getConnection(JDBC_URL, config);
+             Connection batch_conn = conn.unwrap(DuckDBConnection.class).duplicate();
+             Statement stmt = conn.createStatement()) {
+            stmt.execute("SET scheduler_weight = 10");
+            try (ResultSet rs = stmt.executeQuery("SELECT current_setting('scheduler_weight')")) {
+                assertTrue(rs.next());
+                assertEquals(rs.getLong(1), 10L);
+            }
+            assertThrows(() -> { stmt.execute("SET scheduler_weight = 0"); }, SQLException.class);
+
+            // run a large query on one connection, while running small queries on the other connection
+            ExecutorService executor = Executors.newSingleThreadExecutor();
+            try {
+                Future<Long> batch = executor.submit(() -> {
+                    try (Statement batch_stmt = batch_conn.createStatement();
+                         ResultSet rs = batch_stmt.executeQuery(
+                             "SELECT count(DISTINCT i % 1000003) FROM range(20000000) t(i)")) {
+                        rs.next();
+                        return rs.getLong(1);
+                    }
+                });
+                for (int i = 0; i < 20; i++) {
+                    try (ResultSet rs = stmt.executeQuery("SELECT sum(i) FROM range(10000) t(i)")) {
+                        assertTrue(rs.next());
+                        assertEquals(rs.getLong(1), 49995000L);
+                    }
+                }
+                assertEquals(batch.get(), 1000003L);
+            } finally {
+                executor.shutdown();
+            }
+        }
+    }
+
+    private static Void runWhenStarted(CountDownLatch start, Connection conn, String query) throws Exception {
+        start.await();
+        try (Statement stmt = conn.createStatement(); ResultSet rs = stmt.executeQuery(query)) {
+            assertTrue(rs.next());
+            assertEquals(rs.getLong(1), 1000003L);
+        }
+        return null;
+    }
+
+    public static void test_scheduler_weighted_shares() throws Exception {
+        Properties config = new Properties();
+        config.setProperty("scheduler_fair_queuing", "true");
+        config.setProperty("threads", "8");
+        try (Connection heavy_conn = DriverManager.getConnection(JDBC_URL, config);
+             Connection light_conn = heavy_conn.unwrap(DuckDBConnection.class).duplicate()) {
+            try (Statement stmt = heavy_conn.createStatement()) {
+                stmt.execute("SET scheduler_weight = 100");
+                // every task taken from the fair queue is logged with the weight of its producer
+                stmt.execute("SET enable_logging = true");
+                stmt.execute("SET logging_level = 'trace'");
+            }
+
+            String query = "SELECT count(DISTINCT i % 1000003) FROM range(50000000) t(i)";
+            CountDownLatch start = new CountDownLatch(1);
+            ExecutorService executor = Executors.newFixedThreadPool(2);
+            try {
+                Future<Void> heavy = executor.submit(() -> runWhenStarted(start, heavy_conn, query));
+                Future<Void> light = executor.submit(() -> runWhenStarted(start, light_conn, query));
+                start.countDown();
+                heavy.get();
+                light.get();
+            } finally {
+                executor.shutdown();
+            }
+
+            // while both queries had tasks, the query with the higher weight got almost all of the tasks
+            try (Statement stmt = heavy_conn.createStatement();
+                 ResultSet rs = stmt.executeQuery(
+                     "SELECT count(*) FILTER (message LIKE '%weight 100,%'), "
+                     + "count(*) FILTER (message LIKE '%weight 1,%') FROM duckdb_logs "
+                     + "WHERE message LIKE 'FairQueue dequeued %, ready producers 2'")) {
+                assertTrue(rs.next());
+                long heavy_tasks = rs.getLong(1);
+                long light_tasks = rs.getLong(2);
+                assertTrue(heavy_tasks > 0);
+                assertTrue(heavy_tasks >= 10 * light_tasks, heavy_tasks + " tasks with weight 100, " + light_tasks +
+                                                                " tasks with weight 1");
+            }
+        }
+    }
+
+    private static void assertJoinBuildPrefetch(Statement stmt, long build_rows, boolean prefetch) throws Exception {
+        // VARCHAR keys, so the join does not use a perfect hash table
+        try (ResultSet rs = stmt.executeQuery("SELECT count(*) FROM range(" + 2 * build_rows + ") p(k) "
+                                              + "JOIN range(" + build_rows + ") b(k) ON p.k::VARCHAR = b.k::VARCHAR")) {
+            assertTrue(rs.next());
+            assertEquals(rs.getLong(1), build_rows);
+        }
+        try (ResultSet rs = stmt.executeQuery(
+                 "SELECT regexp_extract(message, '[ {]size[^0-9]*([0-9]+)', 1)::BIGINT, "
+                 + "regexp_extract(message, 'cache_size[^0-9]*([0-9]+)', 1)::BIGINT, "
+                 + "regexp_extract(message, 'prefetch[^a-z]*(true|false)', 1) FROM duckdb_logs "
+                 + "WHERE message LIKE '%cache_size%' AND regexp_matches(message, 'rows[^0-9]*" + build_rows +
+                 "[^0-9]')")) {
+            assertTrue(rs.next());
+            long size = rs.getLong(1);
+            long cache_size = rs.getLong(2);
+            assertEquals(size > cache_size, prefetch);
+            assertEquals(rs.getString(3), Boolean.toString(prefetch));
+            assertFalse(rs.next());
+        }
+    }
+
+    public static void test_hash_join_probe_prefetch() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("PRAGMA enable_logging('PhysicalOperator')");
+            // a hash table that fits in the last level cache is probed without prefetching
+            assertJoinBuildPrefetch(stmt, 1000, false);
+
+            long cache_size;
+            try (ResultSet rs =
+                     stmt.executeQuery("SELECT regexp_extract(message, 'cache_size[^0-9]*([0-9]+)', 1)::BIGINT "
+                                       + "FROM duckdb_logs WHERE message LIKE '%cache_size%'")) {
+                assertTrue(rs.next());
+                cache_size = rs.getLong(1);
+            }
+            // every build row takes more than 8 bytes in the hash table and the pointer table, so this hash table
+            // is larger than the cache
+            assertJoinBuildPrefetch(stmt, cache_size / 8, true);
+        }
+    }
+
+    public static void test_external_hash_join() throws Exception {
+        Path temp_directory = Files.createTempDirectory("duckdb-external-join-test-");
+        Properties config = new Properties();
+        config.setProperty("memory_limit", "100MB");
+        config.setProperty("threads", "2");
+        config.setProperty("temp_directory", temp_directory.toString());
+        try (Connection conn = DriverManager.getConnection(JDBC_URL, config); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE build AS SELECT i * 2 AS k, i::VARCHAR || repeat('x', 20) AS v "
+                         + "FROM range(2000000) t(i)");
+            // half of the probe keys are outside of the range of the build keys, and can be discarded
+            stmt.execute("CREATE TABLE probe AS SELECT range AS k FROM range(4000000) "
+                         + "UNION ALL SELECT range FROM range(10000000, 12000000)");
+            try (ResultSet rs = stmt.executeQuery("SELECT count(*), sum(k) FROM probe JOIN build USING (k)")) {
+                assertTrue(rs.next());
+                assertEquals(rs.getLong(1), 2000000L);
+                assertEquals(rs.getLong(2), 3999998000000L);
+            }
+            try (ResultSet rs = stmt.executeQuery("SELECT count(*), count(v) FROM probe LEFT JOIN build USING (k)")) {
+                assertTrue(rs.next());
+                assertEquals(rs.getLong(1), 6000000L);
+                assertEquals(rs.getLong(2), 2000000L);
+            }
+        } finally {
+            Files.deleteIfExists(temp_directory);
+        }
+    }
+
+    public static void test_external_hash_join_heavy_hitter() throws Exception {
+        Path temp_directory = Files.createTempDirectory("duckdb-external-join-test-");
+        Properties config = new Properties();
+        config.setProperty("memory_limit", "100MB");
+        config.setProperty("threads", "2");
+        config.setProperty("temp_directory", temp_directory.toString());
+        try (Connection conn = DriverManager.getConnection(JDBC_URL, config); Statement stmt = conn.createStatement()) {
+            // half of the build side has the same key, which repartitioning cannot split up
+            stmt.execute("CREATE TABLE build AS SELECT CASE WHEN i % 2 = 0 THEN 0 ELSE i END AS k, "
+                         + "i::VARCHAR || repeat('x', 20) AS v FROM range(4000000) t(i)");
+            // the probe side is larger, so the HT is built on the table with the heavy hitter
+            stmt.execute("CREATE TABLE probe AS SELECT range AS k FROM range(8000000) WHERE range % 4 != 1");
+            stmt.execute("PRAGMA enable_logging('PhysicalOperator')");
+            try (ResultSet rs = stmt.executeQuery("SELECT count(*), sum(k) FROM probe JOIN build USING (k)")) {
+                assertTrue(rs.next());
+                assertEquals(rs.getLong(1), 3000000L);
+                assertEquals(rs.getLong(2), 2000001000000L);
+            }
+            try (ResultSet rs = stmt.executeQuery(
+                     "SELECT count(*), count(probe.k) FROM probe RIGHT JOIN build ON probe.k = build.k")) {
+                assertTrue(rs.next());
+                assertEquals(rs.getLong(1), 4000000L);
+                assertEquals(rs.getLong(2), 3000000L);
+            }
+            // both joins went external and split the partition with the heavy hitter, once each
+            assertEquals(countRows(stmt, "SELECT count(*) FROM duckdb_logs WHERE message LIKE '%SplitPartition%'"), 2L);
+        } finally {
+            Files.deleteIfExists(temp_directory);
+        }
+    }
+
+    public static void test_dictionary_encoded_join_payloads() throws Exception {
+        Properties config = new Properties();
+        config.setProperty("dictionary_encode_join_payloads", "true");
+        try (Connection conn = DriverManager.getConnection(JDBC_URL, config); Statement stmt = conn.createStatement()) {
+            // w has more distinct values than fit in the thread-local caches of the dictionary codes
+            stmt.execute("CREATE TABLE build AS SELECT i AS k, CASE WHEN i % 7 = 0 THEN NULL "
+                         + "ELSE 'category ' || (i % 10) || repeat('x', 20) END AS v, (i % 3)::VARCHAR AS s, "
+                         + "'row ' || i || repeat('y', 20) AS w FROM range(100000) t(i)");
+            stmt.execute("CREATE TABLE probe AS SELECT i * 2 AS k FROM range(100000) t(i)");
+            String aggregates =
+                "SELECT count(*), count(v), sum(length(v)), min(v), max(v), min(s), max(s), count(DISTINCT w), max(w) ";
+            String[] queries = new String[] {
+                aggregates + "FROM probe JOIN build USING (k)",
+                aggregates + "FROM probe FULL OUTER JOIN build ON probe.k = build.k",
+                aggregates + "FROM probe LEFT JOIN build ON probe.k = build.k AND build.v LIKE '%4x%'"};
+            for (String query : queries) {
+                stmt.execute("SET dictionary_encode_join_payloads = true");
+                Object[] encoded = new Object[9];
+                try (ResultSet rs = stmt.executeQuery(query)) {
+                    assertTrue(rs.next());
+                    for (int i = 0; i < encoded.length; i++) {
+                        encoded[i] = rs.getObject(i + 1);
+                    }
+                }
+                stmt.execute("SET dictionary_encode_join_payloads = false");
+                try (ResultSet rs = stmt.executeQuery(query)) {
+                    assertTrue(rs.next());
+                    for (int i = 0; i < encoded.length; i++) {
+                        assertEquals(encoded[i], rs.getObject(i + 1));
+                    }
+                }
+            }
+        }
+    }
+
     public static void test_temporal_types() throws Exception {
         Connection conn = DriverManager.getConnection(JDBC_URL);
         Statement stmt = conn.createStatement();
@@ -1,9 +1,12 @@
 package org.duckdb;
 
+import static java.nio.charset.StandardCharsets.UTF_8;
+import static org.duckdb.DuckDBDriver.JDBC_STATEMENT_CACHE_SIZE;
 import static org.duckdb.TestDuckDBJDBC.JDBC_URL;
 import static org.duckdb.test.Assertions.*;
 
 import java.sql.*;
+import java.util.Properties;
 
 public class TestPrepare {
 
@@ -104,6 +107,198 @@ public class TestPrepare {
         }
     }
 
+    public static void test_prepare_primitive_params() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL);
+             PreparedStatement ps = conn.prepareStatement("SELECT ?, typeof(?)")) {
+            ps.setByte(1, Byte.MIN_VALUE);
+            ps.setByte(2, Byte.MIN_VALUE);
+            try (ResultSet rs = ps.executeQuery()) {
+                assertTrue(rs.next());
+                assertEquals(rs.getByte(1), Byte.MIN_VALUE);
+                assertEquals(rs.getString(2), "TINYINT");
+            }
+
+            ps.setShort(1, Short.MIN_VALUE);
+            ps.setShort(2, Short.MIN_VALUE);
+            try (ResultSet rs = ps.executeQuery()) {
+                assertTrue(rs.next());
+                assertEquals(rs.getShort(1), Short.MIN_VALUE);
+                assertEquals(rs.getString(2), "SMALLINT");
+            }
+
+            ps.setInt(1, Integer.MIN_VALUE);
+            ps.setInt(2, Integer.MIN_VALUE);
+            try (ResultSet rs = ps.executeQuery()) {
+                assertTrue(rs.next());
+                assertEquals(rs.getInt(1), Integer.MIN_VALUE);
+                assertEquals(rs.getString(2), "INTEGER");
+            }
+
+            ps.setLong(1, Long.MAX_VALUE);
+            ps.setLong(2, Long.MAX_VALUE);
+            try (ResultSet rs = ps.executeQuery()) {
+                assertTrue(rs.next());
+                assertEquals(rs.getLong(1), Long.MAX_VALUE);
+                assertEquals(rs.getString(2), "BIGINT");
+            }
+
+            ps.setFloat(1, -Float.MAX_VALUE);
+            ps.setFloat(2, Float.NaN);
+            try (ResultSet rs = ps.executeQuery()) {
+                assertTrue(rs.next());
+                assertEquals(rs.getFloat(1), -Float.MAX_VALUE);
+                assertEquals(rs.getString(2), "FLOAT");
+            }
+
+            ps.setDouble(1, Double.MIN_VALUE);
+            ps.setDouble(2, Double.NEGATIVE_INFINITY);
+            try (ResultSet rs = ps.executeQuery()) {
+                assertTrue(rs.next());
+                assertEquals(rs.getDouble(1), Double.MIN_VALUE);
+                assertEquals(rs.getString(2), "DOUBLE");
+            }
+
+            ps.setBoolean(1, true);
+            ps.setBoolean(2, false);
+            try (ResultSet rs = ps.executeQuery()) {
+                assertTrue(rs.next());
+                assertTrue(rs.getBoolean(1));
+                assertEquals(rs.getString(2), "BOOLEAN");
+            }
+
+            // object parameters replace primitive ones and the other way around
+            ps.setString(1, "foo");
+            ps.setNull(2, Types.INTEGER);
+            try (ResultSet rs = ps.executeQuery()) {
+                assertTrue(rs.next());
+                assertEquals(rs.getString(1), "foo");
+            }
+
+            ps.setLong(1, 42);
+            try (ResultSet rs = ps.executeQuery()) {
+                assertTrue(rs.next());
+                assertEquals(rs.getObject(1), 42L);
+            }
+
+            ps.clearParameters();
+            assertThrows(ps::executeQuery, SQLException.class);
+        }
+    }
+
+    public static void test_prepare_statement_cache() throws Exception {
+        Properties props = new Properties();
+        props.setProperty(JDBC_STATEMENT_CACHE_SIZE, String.valueOf(2));
+        String sql = "SELECT * FROM tab1 WHERE col1 = ?";
+
+        try (Connection conn = DriverManager.getConnection(JDBC_URL, props); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE tab1 (col1 INTEGER)");
+            stmt.execute("INSERT INTO tab1 VALUES (41), (42)");
+
+            for (int i = 0; i < 3; i++) {
+                try (PreparedStatement ps = conn.prepareStatement(sql)) {
+                    ps.setInt(1, 42);
+                    try (ResultSet rs = ps.executeQuery()) {
+                        assertEquals(rs.getMetaData().getColumnCount(), 1);
+                        assertTrue(rs.next());
+                        assertEquals(rs.getInt(1), 42);
+                        assertFalse(rs.next());
+                    }
+                }
+            }
+
+            // catalog changes invalidate the cached plan
+            stmt.execute("ALTER TABLE tab1 ADD COLUMN col2 VARCHAR DEFAULT 'foo'");
+            try (PreparedStatement ps = conn.prepareStatement(sql)) {
+                ps.setInt(1, 42);
+                try (ResultSet rs = ps.executeQuery()) {
+                    assertEquals(rs.getMetaData().getColumnCount(), 2);
+                    assertTrue(rs.next());
+                    assertEquals(rs.getString(2), "foo");
+                }
+            }
+
+            // plans are not shared between schemas
+            stmt.execute("CREATE SCHEMA s1");
+            stmt.execute("CREATE TABLE s1.tab1 (col1 INTEGER, col2 INTEGER, col3 INTEGER)");
+            stmt.execute("INSERT INTO s1.tab1 VALUES (42, 43, 44)");
+            stmt.execute("SET schema = 's1'");
+            try (PreparedStatement ps = conn.prepareStatement(sql)) {
+                ps.setInt(1, 42);
+                try (ResultSet rs = ps.executeQuery()) {
+                    assertEquals(rs.getMetaData().getColumnCount(), 3);
+                    assertTrue(rs.next());
+                    assertEquals(rs.getInt(3), 44);
+                }
+            }
+
+            // a temporary table shadows the table the cached plan was bound to
+            stmt.execute("SET schema = 'main'");
+            String unqualified = "SELECT count(*) FROM tab2";
+            stmt.execute("CREATE TABLE tab2 AS SELECT * FROM range(5)");
+            for (int i = 0; i < 2; i++) {
+                try (PreparedStatement ps = conn.prepareStatement(unqualified); ResultSet rs = ps.executeQuery()) {
+                    assertTrue(rs.next());
+                    assertEquals(rs.getLong(1), 5L);
+                }
+            }
+            stmt.execute("CREATE TEMPORARY TABLE tab2 AS SELECT * FROM range(2)");
+            try (PreparedStatement ps = conn.prepareStatement(unqualified); ResultSet rs = ps.executeQuery()) {
+                assertTrue(rs.next());
+                assertEquals(rs.getLong(1), 2L);
+            }
+            stmt.execute("DROP TABLE temp.tab2");
+
+            // plans are not shared between search paths
+            stmt.execute("CREATE TABLE s1.tab2 AS SELECT * FROM range(3)");
+            stmt.execute("SET search_path = 's1,main'");
+            try (PreparedStatement ps = conn.prepareStatement(unqualified); ResultSet rs = ps.executeQuery()) {
+                assertTrue(rs.next());
+                assertEquals(rs.getLong(1), 3L);
+            }
+            stmt.execute("RESET search_path");
+
+            // settings that change how the query is bound invalidate the cached plan
+            String ordered = "SELECT i FROM (VALUES ('b'), ('B'), ('a')) t(i) ORDER BY i LIMIT 1";
+            try (PreparedStatement ps = conn.prepareStatement(ordered); ResultSet rs = ps.executeQuery()) {
+                assertTrue(rs.next());
+                assertEquals(rs.getString(1), "B");
+            }
+            stmt.execute("SET default_collation = 'nocase'");
+            try (PreparedStatement ps = conn.prepareStatement(ordered); ResultSet rs = ps.executeQuery()) {
+                assertTrue(rs.next());
+                assertEquals(rs.getString(1), "a");
+            }
+        }
+    }
+
+    public static void test_prepare_arrow_export() throws Exception {
+        try (DuckDBConnection conn = DriverManager.getConnection(JDBC_URL).unwrap(DuckDBConnection.class);
+             Statement stmt = conn.createStatement();
+             DuckDBPreparedStatement ps =
+                 conn.prepareStatement("SELECT i, i::VARCHAR AS s, CASE WHEN i % 7 = 0 THEN NULL ELSE i END AS n "
+                                       + "FROM range(?) t(i) ORDER BY i")
+                     .unwrap(DuckDBPreparedStatement.class)) {
+            for (long row_count : new long[] {10000, 0}) {
+                ps.setLong(1, row_count);
+                long stream_pointer = ps.arrowExportStreamPointer(1000);
+                // read the exported batches back through an Arrow scan, which consumes and releases the stream
+                DuckDBNative.duckdb_jdbc_arrow_register(conn.connRef, stream_pointer, "exported".getBytes(UTF_8));
+                try (ResultSet rs = stmt.executeQuery("SELECT i, s, n FROM exported ORDER BY i")) {
+                    long count = 0;
+                    while (rs.next()) {
+                        assertEquals(rs.getLong(1), count);
+                        assertEquals(rs.getString(2), String.valueOf(count));
+                        rs.getLong(3);
+                        assertEquals(rs.wasNull(), count % 7 == 0);
+                        count++;
+                    }
+                    assertEquals(count, row_count);
+                }
+                stmt.execute("DROP VIEW exported");
+            }
+        }
+    }
+
     public static void test_prepare_insert() throws Exception {
         try (Connection conn = DriverManager.getConnection(JDBC_URL)) {
 
@@ -1,11 +1,14 @@
 package org.duckdb;
 
+import static org.duckdb.DuckDBDriver.JDBC_PREFETCH_BUFFER_SIZE;
+import static org.duckdb.DuckDBDriver.JDBC_PREFETCH_CHUNKS;
 import static org.duckdb.DuckDBDriver.JDBC_STREAM_RESULTS;
 import static org.duckdb.TestDuckDBJDBC.JDBC_URL;
 import static org.duckdb.test.Assertions.*;
 
 import java.math.BigDecimal;
 import java.math.BigInteger;
+import java.nio.charset.StandardCharsets;
 import java.sql.*;
 import java.time.LocalDateTime;
 import java.util.Properties;
@@ -256,4 +259,191 @@ public class TestResults {
             }
         }
     }
+
+    public static void test_result_streaming_prefetch() throws Exception {
+        Properties props = new Properties();
+        props.setProperty(JDBC_STREAM_RESULTS, String.valueOf(true));
+        props.setProperty(JDBC_PREFETCH_CHUNKS, String.valueOf(4));
+        props.setProperty(JDBC_PREFETCH_BUFFER_SIZE, String.valueOf(1 << 20));
+
+        try (Connection conn = DriverManager.getConnection(JDBC_URL, props); Statement stmt = conn.createStatement()) {
+            try (ResultSet rs = stmt.executeQuery("SELECT i, i::VARCHAR FROM range(100000) t(i) ORDER BY i")) {
+                long count = 0;
+                while (rs.next()) {
+                    assertEquals(rs.getLong(1), count);
+                    assertEquals(rs.getString(2), String.valueOf(count));
+                    count++;
+                }
+                assertEquals(count, 100000L);
+                assertFalse(rs.next());
+            }
+
+            // closing a partially consumed result stops the prefetching
+            try (ResultSet rs = stmt.executeQuery("SELECT * FROM range(1000000)")) {
+                assertTrue(rs.next());
+                assertEquals(rs.getLong(1), 0L);
+            }
+
+            // errors raised while prefetching are reported on fetch
+            assertThrows(() -> {
+                try (ResultSet rs = stmt.executeQuery("SELECT CASE WHEN i < 50000 THEN i ELSE error('boom') END "
+                                                      + "FROM range(100000) t(i)")) {
+                    while (rs.next()) {
+                        rs.getLong(1);
+                    }
+                }
+            }, SQLException.class);
+
+            try (ResultSet rs = stmt.executeQuery("SELECT 42")) {
+                assertTrue(rs.next());
+                assertEquals(rs.getInt(1), 42);
+            }
+        }
+    }
+
+    public static void test_result_streaming_error_after_first_chunk() throws Exception {
+        // the error is raised only after the first chunks were streamed, with and without prefetching
+        for (int prefetch_chunks : new int[] {0, 4}) {
+            Properties props = new Properties();
+            props.setProperty(JDBC_STREAM_RESULTS, String.valueOf(true));
+            props.setProperty(JDBC_PREFETCH_CHUNKS, String.valueOf(prefetch_chunks));
+            props.setProperty("threads", "1");
+
+            try (Connection conn = DriverManager.getConnection(JDBC_URL, props);
+                 Statement stmt = conn.createStatement()) {
+                long[] count = new long[1];
+                assertThrows(() -> {
+                    try (ResultSet rs = stmt.executeQuery("SELECT CASE WHEN i < 3000000 THEN i ELSE error('boom') END "
+                                                          + "FROM range(4000000) t(i)")) {
+                        while (rs.next()) {
+                            count[0]++;
+                        }
+                    }
+                }, SQLException.class);
+                assertTrue(count[0] > 0);
+                assertTrue(count[0] <= 3000000);
+            }
+        }
+    }
+
+    public static void test_result_fetch_size() throws Exception {
+        Properties props = new Properties();
+        props.setProperty(JDBC_STREAM_RESULTS, String.valueOf(true));
+        String query = "SELECT i, CASE WHEN i % 3 = 0 THEN NULL ELSE i::VARCHAR END, [i, NULL]"
+                       + " FROM range(300000) t(i) ORDER BY i";
+
+        for (Properties p : new Properties[] {new Properties(), props}) {
+            try (Connection conn = DriverManager.getConnection(JDBC_URL, p); Statement stmt = conn.createStatement()) {
+                assertEquals(stmt.getFetchSize(), 2048);
+                stmt.setFetchSize(100000);
+                assertEquals(stmt.getFetchSize(), 100000);
+                assertThrows(() -> { stmt.setFetchSize(-1); }, SQLException.class);
+
+                try (ResultSet rs = stmt.executeQuery(query)) {
+                    assertEquals(rs.getFetchSize(), 100000);
+                    long count = 0;
+                    while (rs.next()) {
+                        if (count == 150000) {
+                            rs.setFetchSize(0);
+                            assertEquals(rs.getFetchSize(), 2048);
+                        }
+                        assertEquals(rs.getLong(1), count);
+                        if (count % 3 == 0) {
+                            assertNull(rs.getString(2));
+                        } else {
+                            assertEquals(rs.getString(2), String.valueOf(count));
+                        }
+                        Object[] arr = (Object[]) rs.getArray(3).getArray();
+                        assertEquals(arr[0], count);
+                        assertNull(arr[1]);
+                        count++;
+                    }
+                    assertEquals(count, 300000L);
+                }
+            }
+        }
+    }
+
+    public static void test_results_strings_and_blobs() throws Exception {
+        String query = "SELECT CASE WHEN i % 3 = 0 THEN NULL ELSE '\u00fc' || repeat('x', i % 20) END,"
+                       + " CASE WHEN i % 5 = 0 THEN NULL ELSE ('\\xAA' || i)::BLOB END,"
+                       + " CASE WHEN i % 7 = 0 THEN '' ELSE i::VARCHAR END"
+                       + " FROM range(5000) t(i) ORDER BY i";
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement();
+             ResultSet rs = stmt.executeQuery(query)) {
+            int i = 0;
+            while (rs.next()) {
+                String str = rs.getString(1);
+                if (i % 3 == 0) {
+                    assertNull(str);
+                    assertTrue(rs.wasNull());
+                } else {
+                    assertEquals(str, "\u00fc" + repeat("x", i % 20));
+                    // repeated access returns the same decoded value
+                    assertEquals(rs.getString(1), str);
+                }
+
+                byte[] bytes = rs.getBytes(2);
+                if (i % 5 == 0) {
+                    assertNull(bytes);
+                } else {
+                    byte[] expected = ("\u00AA" + i).getBytes(StandardCharsets.ISO_8859_1);
+                    assertEquals(bytes, expected, "blob mismatch at row " + i);
+                    Blob blob = rs.getBlob(2);
+                    assertEquals(blob.length(), (long) expected.length);
+                }
+
+                assertEquals(rs.getString(3), i % 7 == 0 ? "" : String.valueOf(i));
+                i++;
+            }
+            assertEquals(i, 5000);
+        }
+    }
+
+    public static void test_results_validity_mask() throws Exception {
+        String query = "SELECT i, CASE WHEN i % 64 = 63 THEN NULL ELSE i END,"
+                       + " CASE WHEN i % 2 = 0 THEN NULL"
+                       + " ELSE {'a': i, 'b': CASE WHEN i % 3 = 0 THEN NULL ELSE 'x' END} END,"
+                       + " [i, NULL]"
+                       + " FROM range(3000) t(i) ORDER BY i";
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement();
+             ResultSet rs = stmt.executeQuery(query)) {
+            int i = 0;
+            while (rs.next()) {
+                assertEquals(rs.getLong(1), (long) i);
+                assertFalse(rs.wasNull());
+
+                Object val = rs.getObject(2);
+                if (i % 64 == 63) {
+                    assertNull(val);
+                    assertTrue(rs.wasNull());
+                } else {
+                    assertEquals(val, (long) i);
+                }
+
+                Struct struct = (Struct) rs.getObject(3);
+                if (i % 2 == 0) {
+                    assertNull(struct);
+                } else {
+                    Object[] attrs = struct.getAttributes();
+                    assertEquals(attrs[0], (long) i);
+                    assertEquals(attrs[1], i % 3 == 0 ? null : "x");
+                }
+
+                Object[] list = (Object[]) rs.getArray(4).getArray();
+                assertEquals(list[0], (long) i);
+                assertNull(list[1]);
+                i++;
+            }
+            assertEquals(i, 3000);
+        }
+    }
+
+    private static String repeat(String str, int count) {
+        StringBuilder sb = new StringBuilder();
+        for (int i = 0; i < count; i++) {
+            sb.append(str);
+        }
+        return sb.toString();
+    }
 }
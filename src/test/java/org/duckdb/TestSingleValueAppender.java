@@ -4,7 +4,11 @@ import static org.duckdb.TestDuckDBJDBC.JDBC_URL;
 import static org.duckdb.test.Assertions.*;
 import static org.duckdb.test.Assertions.assertTrue;
 
+import java.io.ByteArrayOutputStream;
 import java.math.BigDecimal;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.StandardCharsets;
 import java.security.SecureRandom;
 import java.sql.*;
 import java.time.LocalDateTime;
@@ -61,6 +65,137 @@ public class TestSingleValueAppender {
         }
     }
 
+    public static void test_sv_appender_columns() throws Exception {
+        try (DuckDBConnection conn = DriverManager.getConnection(JDBC_URL).unwrap(DuckDBConnection.class);
+             Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE tab1 (a BIGINT, b INTEGER, c DOUBLE, d BOOLEAN, e VARCHAR, f BLOB)");
+
+            int count = 5000;
+            long[] longs = new long[count + 1];
+            int[] ints = new int[count + 1];
+            boolean[] bools = new boolean[count + 1];
+            long[] nullMask = new long[(count + 1 + 63) / 64];
+            ByteBuffer doubles = ByteBuffer.allocateDirect((count + 1) * 8).order(ByteOrder.nativeOrder());
+            ByteArrayOutputStream strings = new ByteArrayOutputStream();
+            int[] offsets = new int[count + 2];
+            for (int i = 0; i <= count; i++) {
+                longs[i] = i;
+                ints[i] = -i;
+                bools[i] = i % 2 == 0;
+                doubles.putDouble(i * 8, i / 4.0);
+                if (i % 7 == 0) {
+                    nullMask[i / 64] |= 1L << (i % 64);
+                }
+                byte[] str = ("str\u00e4" + i).getBytes(StandardCharsets.UTF_8);
+                strings.write(str, 0, str.length);
+                offsets[i + 1] = offsets[i] + str.length;
+            }
+            byte[] stringData = strings.toByteArray();
+
+            try (DuckDBSingleValueAppender appender =
+                     conn.createSingleValueAppender(DuckDBConnection.DEFAULT_SCHEMA, "tab1")) {
+                appender.beginRow();
+                appender.append(-1L);
+                appender.append(1);
+                appender.append(0.5);
+                appender.append(true);
+                appender.append("first");
+                appender.append(new byte[] {1});
+                appender.endRow();
+
+                // values at offset 1, so the row i of the block holds value i + 1
+                appender.beginColumns(count);
+                appender.appendColumn(0, longs, 1, null);
+                appender.appendColumn(1, ints, 1, nullMask);
+                appender.appendColumn(2, doubles, 1, null);
+                appender.appendColumn(3, bools, 1, null);
+                appender.appendStringColumn(4, stringData, offsets, 1, nullMask);
+                appender.appendStringColumn(5, stringData, offsets, 1, null);
+                appender.endColumns();
+
+                appender.beginColumns(1);
+                assertThrows(() -> { appender.appendColumn(0, ints, 0, null); }, SQLException.class);
+                assertThrows(() -> { appender.appendColumn(4, longs, 0, null); }, SQLException.class);
+                assertThrows(() -> { appender.appendColumn(0, longs, count + 1, null); }, SQLException.class);
+                appender.appendColumn(0, longs, 0, null);
+                assertThrows(appender::endColumns, SQLException.class);
+                appender.flush();
+            }
+
+            try (ResultSet rs = stmt.executeQuery("SELECT count(*), count(b), sum(a), sum(c), count(*) FILTER (d) "
+                                                  + "FROM tab1")) {
+                assertTrue(rs.next());
+                assertEquals(rs.getLong(1), (long) count + 1);
+                assertEquals(rs.getLong(2), (long) count + 1 - (count / 7));
+                assertEquals(rs.getLong(3), (long) count * (count + 1) / 2 - 1);
+                assertEquals(rs.getDouble(4), 0.5 + (count * (count + 1) / 2) / 4.0);
+                assertEquals(rs.getLong(5), 1L + count / 2);
+            }
+            try (ResultSet rs = stmt.executeQuery("SELECT * FROM tab1 WHERE a IN (-1, 7, 4999) ORDER BY a")) {
+                assertTrue(rs.next());
+                assertEquals(rs.getString(5), "first");
+                assertTrue(rs.next());
+                assertEquals(rs.getLong(1), 7L);
+                assertNull(rs.getObject(2));
+                assertEquals(rs.getDouble(3), 1.75);
+                assertFalse(rs.getBoolean(4));
+                assertNull(rs.getString(5));
+                assertEquals(rs.getBytes(6), "str\u00e47".getBytes(StandardCharsets.UTF_8), "blob");
+                assertTrue(rs.next());
+                assertEquals(rs.getLong(1), 4999L);
+                assertEquals(rs.getInt(2), -4999);
+                assertTrue(rs.getBoolean(4) == false);
+                assertEquals(rs.getString(5), "str\u00e44999");
+                assertFalse(rs.next());
+            }
+        }
+    }
+
+    public static void test_sv_appender_columns_flush_boundaries() throws Exception {
+        // matches DEFAULT_ROW_GROUP_SIZE, column-wise blocks are flushed every whole row group
+        int rowGroupSize = 122880;
+        try (DuckDBConnection conn = DriverManager.getConnection(JDBC_URL).unwrap(DuckDBConnection.class);
+             Connection other = conn.duplicate(); Statement stmt = other.createStatement()) {
+            stmt.execute("CREATE TABLE tab1 (a BIGINT)");
+
+            int count = 2 * rowGroupSize;
+            long[] longs = new long[count];
+            for (int i = 0; i < count; i++) {
+                longs[i] = i;
+            }
+            try (DuckDBSingleValueAppender appender =
+                     conn.createSingleValueAppender(DuckDBConnection.DEFAULT_SCHEMA, "tab1")) {
+                for (int i = 0; i < 10; i++) {
+                    appender.beginRow();
+                    appender.append(-1L);
+                    appender.endRow();
+                }
+                assertEquals(countRows(stmt), 0L);
+
+                // the 10 rows appended row-wise and the first rows of the block fill the first row group, the
+                // last 10 rows of the block stay pending
+                appender.beginColumns(count);
+                appender.appendColumn(0, longs, 0, null);
+                appender.endColumns();
+                assertEquals(countRows(stmt), (long) count);
+
+                // a block smaller than the remaining space of the row group is not flushed
+                appender.beginColumns(100);
+                appender.appendColumn(0, longs, 0, null);
+                appender.endColumns();
+                assertEquals(countRows(stmt), (long) count);
+            }
+            assertEquals(countRows(stmt), (long) count + 110);
+        }
+    }
+
+    private static long countRows(Statement stmt) throws SQLException {
+        try (ResultSet rs = stmt.executeQuery("SELECT count(*) FROM tab1")) {
+            assertTrue(rs.next());
+            return rs.getLong(1);
+        }
+    }
+
     public static void test_sv_appender_date_and_time() throws Exception {
         try (DuckDBConnection conn = DriverManager.getConnection(JDBC_URL).unwrap(DuckDBConnection.class);
              Statement stmt = conn.createStatement()) {